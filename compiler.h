@@ -14,3 +14,29 @@
 #define unlikely(X) X
 #endif
 
+
+// x86_64 vector paths. Functions using them are compiled with target
+// attributes and picked at runtime, so the build flags can stay generic
+#if defined(__x86_64__) && defined(__GNUC__)
+#define SWAR_X86 1
+#define TARGET(X) __attribute__ ((target (X)))
+#else
+#define SWAR_X86 0
+#define TARGET(X)
+#endif
+
+// Widest vector the long scanners may use: 32 (AVX2), 16 (SSE2) or 8 (SWAR).
+// Define as 8 to keep the SSE/AVX units, and their P-state switches, away
+#ifndef SWAR_MAX_VECWIDTH
+#define SWAR_MAX_VECWIDTH 32
+#endif
+
+// True when a constexpr function is evaluated at compile time, so it can
+// avoid memcpy and reads past the end of literals there.
+// std::is_constant_evaluated() is C++20, g++ 9 has the builtin in C++17
+#if defined(__GNUC__)
+#define SWAR_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#include <type_traits>
+#define SWAR_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#endif
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "swar.h"
+
+namespace swar {
+namespace fix {
+
+//
+// FIX tag=value parsing
+//
+// Fields are <tag>=<value><SOH>. Values are assumed printable, so binary
+// fields, like RawData(96), must be skipped by the caller using the
+// preceding length field.
+//
+
+const char SOH = '\x01';
+
+// One field. value points into the message, and is not terminated
+struct field {
+    uint32_t tag;
+    const char* value;
+    uint32_t len;
+};
+
+// Walk the fields of a message, without copying.
+// Reads up to 7 bytes past the end of a tag, like the other SWAR functions.
+//
+//   swar::fix::field_iterator it(msg, len);
+//   swar::fix::field f;
+//   while (it.next(f)) {
+//       ...
+//   }
+class field_iterator {
+public:
+    // Anything after the last SOH is not a complete field, and is ignored
+    field_iterator(const char* msg, uint32_t len) : p(msg), end(msg) {
+        uint32_t last = pmemrchr(msg, len, SOH);
+        end += last + 1; // -1 + 1 is an empty message
+    }
+
+    // The tag reads past the end stay in the padding
+    explicit field_iterator(padded_view msg) : field_iterator(msg.data, msg.len) {}
+
+    // Parse the next field. Returns false at the end, or on a field
+    // without '=', with an empty tag or a tag longer than 7 digits
+    bool next(field& f) {
+        if (p == end)
+            return false;
+
+        // Tag ends within the first word.
+        // eq - 1 wraps around if eq is 0, or -1
+        uint32_t eq = pmemchr8(p, '=');
+        if (unlikely(eq - 1 >= 7))
+            return false;
+
+        // The message ends with SOH, so there is one past every value.
+        // Search from the field start, so it does not wait for eq.
+        // Values are short, so skip the vector dispatch of pmemchrk
+        uint32_t soh = _memchr<true, true>(p, end - p, SOH);
+        if (unlikely(eq >= soh))
+            return false;
+
+        f.tag = likely(eq <= 4) ? atou4(p, eq) : atou8(p, eq);
+        f.value = p + eq + 1;
+        f.len = soh - eq - 1;
+
+        p += soh + 1;
+        return true;
+    }
+
+    // Remaining, unparsed, part of the message
+    const char* pos() const { return p; }
+
+private:
+    const char* p;
+    const char* end;
+};
+
+// Walk the fields of a message with bitmaps of '=' and SOH.
+// Each 64 byte block is indexed in one pass, and fields are then found
+// with ctz and clearing the lowest bit, with no more scanning.
+// Indexing never reads past the end. The tag is parsed from a whole word.
+//
+//   swar::fix::index_iterator it(msg, len);
+//   swar::fix::field f;
+//   while (it.next(f)) {
+//       ...
+//   }
+class index_iterator {
+public:
+    index_iterator(const char* msg, uint32_t len)
+        : p(msg), msg(msg), len(len), off(0), eq(0), soh(0), padded(false) {
+        _bitmap64v<true>(msg, len, '=', SOH, eq, soh);
+    }
+
+    // The last block is indexed in place, with no copy
+    explicit index_iterator(padded_view msg)
+        : p(msg.data), msg(msg.data), len(msg.len), off(0), eq(0), soh(0), padded(true) {
+        _bitmap64v<true, true>(msg.data, len, '=', SOH, eq, soh);
+    }
+
+    // Parse the next field. Returns false at the end, on an incomplete
+    // last field, or on a field without '=', with an empty tag or a tag
+    // longer than 7 digits
+    bool next(field& f) {
+        // Find '='. A SOH before it means a field without '='
+        while (!(eq | soh)) {
+            if (!advance())
+                return false;
+        }
+        if (unlikely(soh & ((eq & -eq) - 1)))
+            return false;
+
+        const char* e = msg + off + __builtin_ctzll(eq);
+        uint32_t tlen = e - p;
+        if (unlikely(tlen - 1 >= 7))
+            return false;
+
+        f.tag = likely(tlen <= 4) ? atou4(p, tlen) : atou8(p, tlen);
+        f.value = e + 1;
+
+        // Find SOH. It may be a few blocks away
+        while (!soh) {
+            if (!advance())
+                return false;
+        }
+        uint64_t bit = soh & -soh;
+        const char* s = msg + off + __builtin_ctzll(soh);
+        f.len = s - f.value;
+
+        // Clear this SOH, and any '=' in the value
+        soh ^= bit;
+        eq &= -(bit << 1);
+
+        p = s + 1;
+        return true;
+    }
+
+    // Remaining, unparsed, part of the message
+    const char* pos() const { return p; }
+
+private:
+    // Index the next block
+    bool advance() {
+        if (len - off <= 64)
+            return false;
+        off += 64;
+        if (padded)
+            _bitmap64v<true, true>(msg + off, len - off, '=', SOH, eq, soh);
+        else
+            _bitmap64v<true>(msg + off, len - off, '=', SOH, eq, soh);
+        return true;
+    }
+
+    const char* p;    // start of the current field
+    const char* msg;
+    uint32_t len;
+    uint32_t off;     // offset of the indexed block
+    uint64_t eq;      // '=' not yet consumed, in the block
+    uint64_t soh;     // SOH not yet consumed, in the block
+    bool padded;      // msg is followed by padding
+};
+
+} // namespace fix
+} // namespace swar
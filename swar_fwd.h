@@ -20,10 +20,16 @@ namespace swar {
 //          k       Haystack is known to contain needle
 //          _nc     Non-const, modifiable, input
 //                  These functions modify and restore the input. Not thread safe
+//          _ci     Case insensitive, for ASCII letters
+//  Template flag
+//          Aligned Read aligned words only, so never cross a page the string
+//                  does not cross. For strings that end a mapped page, like
+//                  mmap'ed files. Otherwise, whole words are read past the end
 //
 // Performance
 //  Functions with 8 suffix are branchless. Function with longer input must
-//  have a branch per word. This can be improved with SSE.
+//  have a branch per word. memchr and memrchr use SSE2 or AVX2, picked once
+//  at startup, for inputs longer than 16 bytes. SWAR_MAX_VECWIDTH limits that.
 //  - SSE may switch some processors to different P state, if the BIOS allows,
 //    and the switching itself can take a few hundred cycles
 //  - Branchless code is not always faster than branched code.
@@ -39,67 +45,92 @@ namespace swar {
 //
 // Utils
 //
+// The word functions, and the integer parse and format functions, are
+// constexpr. At compile time they read and write bytes instead of memcpy,
+// and the parsers read only len chars, so literals work. The 8 suffix
+// search functions still read all 8 chars.
+//
 
 // Cast char* to T using memcpy. memcpy is optimized away on x86
-template <typename T> inline T cast(const char* src);
+template <typename T> constexpr T cast(const char* src);
 
 // Get the uint _cast_ of a string of up to 8 chars
-inline uint64_t cast8(const char* s, uint32_t len);
+constexpr uint64_t cast8(const char* s, uint32_t len);
 
 // Fill T with c's
-template <typename T> inline T extend(char c);
+template <typename T> constexpr T extend(char c);
+
+// Store T to char* using memcpy. memcpy is optimized away on x86
+template <typename T> constexpr void _store(char* dst, T x);
 
 // swap bytes
-inline uint64_t bswap(uint64_t x);
-inline uint32_t bswap(uint32_t x);
-inline uint16_t bswap(uint16_t x);
+constexpr uint64_t bswap(uint64_t x);
+constexpr uint32_t bswap(uint32_t x);
+constexpr uint16_t bswap(uint16_t x);
 
 //
 // Find byte in word
 //
 
 // Check if word has zero byte
-inline bool haszero(uint64_t x);
+constexpr bool haszero(uint64_t x);
 
 // Check if word has some byte
-inline bool hasbyte(uint64_t x, uint8_t c);
+constexpr bool hasbyte(uint64_t x, uint8_t c);
+
+// Set the high bit in zero bytes, and clear all other bits
+template<bool Printable>
+constexpr uint64_t _zerobytes(uint64_t x);
+
+// Find the first, or last, byte with the high bit set
+template<bool Exists, bool Reverse>
+constexpr uint32_t _bytepos(uint64_t x);
+
+// Mask of the low n bytes, n <= 8
+constexpr uint64_t _bytesmask(uint32_t n);
 
 // Find char in string. Support all options.
 template<bool Printable, bool Exists, bool Reverse=false>
-inline uint32_t _memchr8(const char* s, uint8_t c);
+constexpr uint32_t _memchr8(const char* s, uint8_t c);
 
 // Find char in string and trim it
 template<bool Printable, bool Exists>
 inline uint32_t _trim8(const char* s, uint8_t c);
 
 // Find char in printable (chars < 128) string of 8 chars
-inline uint32_t pmemchr8(const char* s, uint8_t c);
+constexpr uint32_t pmemchr8(const char* s, uint8_t c);
 
 // Find char in printable (chars < 128) string of 8 chars
 // * The string is known to contain the char
-inline uint32_t pmemchr8k(const char* s, uint8_t c);
+constexpr uint32_t pmemchr8k(const char* s, uint8_t c);
 
 // Find char in binary string of 8 chars
-inline uint32_t memchr8(const char* s, uint8_t c);
+constexpr uint32_t memchr8(const char* s, uint8_t c);
 
 // Find char in binary string of 8 chars
 // * The string is known to contain the char
-inline uint32_t memchr8k(const char* s, uint8_t c);
+constexpr uint32_t memchr8k(const char* s, uint8_t c);
 
 //
 // Strlen variants
 //
 
 // Find zero byte in binary string up to 8 chars
-inline uint32_t strlen8(const char* s);
+constexpr uint32_t strlen8(const char* s);
 
 // Find zero byte in printable string up to 8 chars
-inline uint32_t pstrlen8(const char* s);
+constexpr uint32_t pstrlen8(const char* s);
+
+// Find zero byte in string. Support all options
+template<bool Printable, bool Aligned>
+inline uint32_t _strlen(const char* s);
 
 // Find zero byte in binary string
+template<bool Aligned = false>
 inline uint32_t strlen(const char* s);
 
 // Find zero byte in printable string
+template<bool Aligned = false>
 inline uint32_t pstrlen(const char* s);
 
 //
@@ -107,37 +138,119 @@ inline uint32_t pstrlen(const char* s);
 //
 
 // Find char in printable (chars < 128) string of 8 chars
-inline uint32_t pmemrchr8(const char* s, uint8_t c);
+constexpr uint32_t pmemrchr8(const char* s, uint8_t c);
 
 // Find char in printable (chars < 128) string of 8 chars
 // * The string is known to contain the char
-inline uint32_t pmemrchr8k(const char* s, uint8_t c);
+constexpr uint32_t pmemrchr8k(const char* s, uint8_t c);
 
 // Find char in binary string of 8 chars
-inline uint32_t memrchr8(const char* s, uint8_t c);
+constexpr uint32_t memrchr8(const char* s, uint8_t c);
 
 // Find char in binary string of 8 chars
 // * The string is known to contain the char
-inline uint32_t memrchr8k(const char* s, uint8_t c);
+constexpr uint32_t memrchr8k(const char* s, uint8_t c);
+
+//
+// Generic scanners. M is a matcher, like _match1, with m8, m16 and m32
+//
+
+// Find first match in const string, word at a time
+template<bool Known, typename M>
+inline uint32_t _scan(const char* s, uint32_t len, const M& m);
+
+// Find last match in const string, word at a time
+template<bool Known, typename M>
+inline uint32_t _rscan(const char* s, uint32_t len, const M& m);
+
+#if SWAR_X86
+// Vector width picked by cpuid. 32 - AVX2, 16 - SSE2, 8 - SWAR
+inline uint32_t _cpu_vecwidth();
+
+// SSE4.1, for the number parsers, picked by cpuid
+inline bool _cpu_sse41();
+
+// Find first match in const string, 16 bytes at a time
+template<bool Known, typename M>
+TARGET("sse2")
+inline uint32_t _vscan16(const char* s, uint32_t len, const M& m);
+
+// Find first match in const string, 32 bytes at a time
+template<bool Known, typename M>
+TARGET("avx2")
+inline uint32_t _vscan32(const char* s, uint32_t len, const M& m);
+
+// Find last match in const string, 16 bytes at a time
+template<bool Known, typename M>
+TARGET("sse2")
+inline uint32_t _vrscan16(const char* s, uint32_t len, const M& m);
+
+// Find last match in const string, 32 bytes at a time
+template<bool Known, typename M>
+TARGET("avx2")
+inline uint32_t _vrscan32(const char* s, uint32_t len, const M& m);
+
+// Find char in const string, 16 bytes at a time
+template<bool Known>
+TARGET("sse2")
+inline uint32_t _memchr16(const char* s, uint32_t len, uint8_t c);
+
+// Find char in const string, 32 bytes at a time
+template<bool Known>
+TARGET("avx2")
+inline uint32_t _memchr32(const char* s, uint32_t len, uint8_t c);
+
+// Find char, in reverse, in const string, 16 bytes at a time
+template<bool Known>
+TARGET("sse2")
+inline uint32_t _memrchr16(const char* s, uint32_t len, uint8_t c);
+
+// Find char, in reverse, in const string, 32 bytes at a time
+template<bool Known>
+TARGET("avx2")
+inline uint32_t _memrchr32(const char* s, uint32_t len, uint8_t c);
+#endif
+
+// Find first match in const string. Widest path the cpu has
+template<bool Known, typename M>
+inline uint32_t _scanv(const char* s, uint32_t len, const M& m);
+
+// Find last match in const string. Widest path the cpu has
+template<bool Known, typename M>
+inline uint32_t _rscanv(const char* s, uint32_t len, const M& m);
 
 //
 // Find byte in const string. Like memchr
 //
 
+// Find char, or last char, in const string, with aligned words only.
+// No read crosses a page the string does not cross
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _amemchr(const char* s, uint32_t len, uint8_t c);
+
 // Find char in const binary string
-template<bool Printable, bool Known>
+template<bool Printable, bool Known, bool Aligned = false>
 inline uint32_t _memchr(const char* s, uint32_t len, uint8_t c);
 
+// Find char in const string. Widest path the cpu has.
+// The vector loads are aligned, but the SWAR fallback of _scanv is not
+template<bool Printable, bool Known, bool Aligned = false>
+inline uint32_t _memchrv(const char* s, uint32_t len, uint8_t c);
+
 // Find char in binary string
+template<bool Aligned = false>
 inline uint32_t memchr(const char* s, uint32_t len, uint8_t c);
 
 // Find char in binary string. Char c is known to be in s + len
+template<bool Aligned = false>
 inline uint32_t memchrk(const char* s, uint32_t len, uint8_t c);
 
 // Find char in printable string
+template<bool Aligned = false>
 inline uint32_t pmemchr(const char* s, uint32_t len, uint8_t c);
 
 // Find char in printable string. Char c is known to be in s + len
+template<bool Aligned = false>
 inline uint32_t pmemchrk(const char* s, uint32_t len, uint8_t c);
 
 //
@@ -145,21 +258,250 @@ inline uint32_t pmemchrk(const char* s, uint32_t len, uint8_t c);
 //
 
 // Find char, in reverse, in const binary string
-template<bool Printable, bool Known>
+template<bool Printable, bool Known, bool Aligned = false>
 inline uint32_t _memrchr(const char* s, uint32_t len, uint8_t c);
 
+// Find char, in reverse, in const string. Widest path the cpu has
+template<bool Printable, bool Known, bool Aligned = false>
+inline uint32_t _memrchrv(const char* s, uint32_t len, uint8_t c);
+
 // Find char in binary string
+template<bool Aligned = false>
 inline uint32_t memrchr(const char* s, uint32_t len, uint8_t c);
 
 // Find char in binary string. Char c is known to be in s + len
+template<bool Aligned = false>
 inline uint32_t memrchrk(const char* s, uint32_t len, uint8_t c);
 
 // Find char in printable string
+template<bool Aligned = false>
 inline uint32_t pmemrchr(const char* s, uint32_t len, uint8_t c);
 
 // Find char in printable string. Char c is known to be in s + len
+template<bool Aligned = false>
 inline uint32_t pmemrchrk(const char* s, uint32_t len, uint8_t c);
 
+//
+// Find any of a few bytes, in one pass
+//
+
+// Set of bytes for memchrset
+struct byteset {
+    uint64_t bits[4]; // 256 bit bitmap
+    uint8_t lo[16];   // bit (c >> 4) of lo[c & 15] for c < 128, for pshufb
+    uint8_t hi[16];   // bit (c >> 4) - 8 of hi[c & 15] for c >= 128
+
+    inline byteset();
+    inline byteset(const char* chars, uint32_t len);
+    inline void add(uint8_t c);
+    inline bool has(uint8_t c) const;
+};
+
+// Find any of 2 chars in a string of 8 chars. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+inline uint32_t _memchr8(const char* s, uint8_t c1, uint8_t c2);
+
+// Find any of 3 chars in a string of 8 chars. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+inline uint32_t _memchr8(const char* s, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find any char of a set in a string of 8 chars. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+inline uint32_t _memchr8(const char* s, const byteset& set);
+
+// Find any of 2 chars in const string. Support all options
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _memchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find any of 3 chars in const string. Support all options
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _memchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find any char of a set in const string. Support all options
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _memchrset(const char* s, uint32_t len, const byteset& set);
+
+// Find any of 2 chars in binary string
+inline uint32_t memchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find any of 2 chars in binary string. One is known to be in s + len
+inline uint32_t memchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find any of 2 chars in printable string
+inline uint32_t pmemchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find any of 2 chars in printable string. One is known to be in s + len
+inline uint32_t pmemchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find last of any of 2 chars in binary string
+inline uint32_t memrchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find last of any of 2 chars in binary string. One is known to be in s + len
+inline uint32_t memrchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find last of any of 2 chars in printable string
+inline uint32_t pmemrchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find last of any of 2 chars in printable string. One is known to be in s + len
+inline uint32_t pmemrchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2);
+
+// Find any of 3 chars in binary string
+inline uint32_t memchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find any of 3 chars in binary string. One is known to be in s + len
+inline uint32_t memchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find any of 3 chars in printable string
+inline uint32_t pmemchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find any of 3 chars in printable string. One is known to be in s + len
+inline uint32_t pmemchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find last of any of 3 chars in binary string
+inline uint32_t memrchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find last of any of 3 chars in binary string. One is known to be in s + len
+inline uint32_t memrchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find last of any of 3 chars in printable string
+inline uint32_t pmemrchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find last of any of 3 chars in printable string. One is known to be in s + len
+inline uint32_t pmemrchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3);
+
+// Find any char of a set in binary string
+inline uint32_t memchrset(const char* s, uint32_t len, const byteset& set);
+
+// Find any char of a set in binary string. One is known to be in s + len
+inline uint32_t memchrsetk(const char* s, uint32_t len, const byteset& set);
+
+// Find any char of a set in printable string
+inline uint32_t pmemchrset(const char* s, uint32_t len, const byteset& set);
+
+// Find any char of a set in printable string. One is known to be in s + len
+inline uint32_t pmemchrsetk(const char* s, uint32_t len, const byteset& set);
+
+// Find last of any char of a set in binary string
+inline uint32_t memrchrset(const char* s, uint32_t len, const byteset& set);
+
+// Find last of any char of a set in binary string. One is known to be in s + len
+inline uint32_t memrchrsetk(const char* s, uint32_t len, const byteset& set);
+
+// Find last of any char of a set in printable string
+inline uint32_t pmemrchrset(const char* s, uint32_t len, const byteset& set);
+
+// Find last of any char of a set in printable string. One is known to be in s + len
+inline uint32_t pmemrchrsetk(const char* s, uint32_t len, const byteset& set);
+
+//
+// Find substring. Like memmem.
+// Candidates are the positions where both the first and the last char of
+// the needle match, found a word, or a vector, at a time. Only those are
+// compared with the needle. Whole words are read past the end of s, but
+// not past the end of the needle
+//
+
+// Needle of 2 or more chars, for memmem. The first 16 chars are packed in
+// 2 words, to verify a candidate with 2 compares
+struct _needle {
+    const char* s;
+    uint32_t len;
+    uint64_t first, last; // the first and last chars, in all 8 bytes
+    uint64_t w0, w1;
+
+    inline _needle(const char* s, uint32_t len);
+
+    // Set the high bit of byte i if p[i] and p[i + len - 1] are the first
+    // and last chars, and clear all other bits
+    template<bool Printable>
+    inline uint64_t ends8(const char* p) const;
+
+    // Is the needle at p?
+    inline bool at(const char* p) const;
+};
+
+// Find needle in the positions from, to m, of s, word at a time
+template<bool Printable>
+inline uint32_t _memmem_scan(const char* s, uint32_t from, uint32_t m, const _needle& n);
+
+// Find last needle in the positions before m, of s, word at a time
+template<bool Printable>
+inline uint32_t _memmem_rscan(const char* s, uint32_t m, const _needle& n);
+
+#if SWAR_X86
+// Find needle in the first m positions of s, 16 positions at a time
+template<bool Printable>
+TARGET("sse2")
+inline uint32_t _memmem_vscan16(const char* s, uint32_t m, const _needle& n);
+
+// Find needle in the first m positions of s, 32 positions at a time
+template<bool Printable>
+TARGET("avx2")
+inline uint32_t _memmem_vscan32(const char* s, uint32_t m, const _needle& n);
+
+// Find last needle in the first m positions of s, 16 positions at a time
+template<bool Printable>
+TARGET("sse2")
+inline uint32_t _memmem_vrscan16(const char* s, uint32_t m, const _needle& n);
+
+// Find last needle in the first m positions of s, 32 positions at a time
+template<bool Printable>
+TARGET("avx2")
+inline uint32_t _memmem_vrscan32(const char* s, uint32_t m, const _needle& n);
+#endif
+
+// Find needle, or last needle, in const string. Widest path the cpu has
+template<bool Printable, bool Reverse>
+inline uint32_t _memmem(const char* s, uint32_t len, const char* needle, uint32_t nlen);
+
+// Find needle in binary string. An empty needle is at 0
+inline uint32_t memmem(const char* s, uint32_t len, const char* needle, uint32_t nlen);
+
+// Find needle in printable string. An empty needle is at 0
+inline uint32_t pmemmem(const char* s, uint32_t len, const char* needle, uint32_t nlen);
+
+// Find last needle in binary string. An empty needle is at len
+inline uint32_t memrmem(const char* s, uint32_t len, const char* needle, uint32_t nlen);
+
+// Find last needle in printable string. An empty needle is at len
+inline uint32_t pmemrmem(const char* s, uint32_t len, const char* needle, uint32_t nlen);
+
+//
+// Bitmaps of char positions, 64 bytes at a time.
+// Bit j of word i is set if s[i * 64 + j] is the char.
+// Walk them with ctz, and clear the lowest bit with x &= x - 1
+//
+
+// Gather the high bits of the 8 bytes into the low 8 bits
+inline uint32_t _highbits(uint64_t x);
+
+// Bitmaps of c1 and c2 in 64 bytes
+template<bool Printable>
+inline void _bitmap64(const char* s, uint8_t c1, uint8_t c2, uint64_t& b1, uint64_t& b2);
+
+#if SWAR_X86
+// Bitmaps of c1 and c2 in 64 bytes, with AVX2
+TARGET("avx2")
+inline void _bitmap64avx2(const char* s, uint8_t c1, uint8_t c2, uint64_t& b1, uint64_t& b2);
+#endif
+
+// Bitmaps of c1 and c2 in up to 64 bytes. Widest path the cpu has.
+// Bits past len are clear. Never reads past len, unless Padded
+template<bool Printable, bool Padded = false>
+inline void _bitmap64v(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t& b1, uint64_t& b2);
+
+// Bitmaps of c1 and c2 in a string. Support all options
+template<bool Printable>
+inline void _bitindex(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t* b1, uint64_t* b2);
+
+// Bitmaps of c1 and c2 in a binary string.
+// b1 and b2 have (len + 63) / 64 words
+inline void bitindex(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t* b1, uint64_t* b2);
+
+// Bitmaps of c1 and c2 in a printable string.
+// b1 and b2 have (len + 63) / 64 words
+inline void pbitindex(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t* b1, uint64_t* b2);
+
 //
 // Find byte in NON-CONST string
 //
@@ -173,62 +515,485 @@ inline uint32_t memchr_nc(char* s, uint32_t len, uint8_t c);
 // Find char in printable NON-CONST string
 inline uint32_t pmemchr_nc(char* s, uint32_t len, uint8_t c);
 
+//
+// Padded strings. Scanned with whole words and blocks, so there is no tail
+// masking, no sentinel, and no write to the string
+//
+
+// Readable bytes after the end of a padded string. A whole 64 byte block,
+// so the bitmap tokenizers need no copy of the last block either
+const uint32_t padding = 64;
+
+// A string followed by at least padding readable bytes.
+// The padding may hold anything. It is read, and never used
+struct padded_view {
+    const char* data;
+    uint32_t len;
+
+    padded_view(const char* data, uint32_t len) : data(data), len(len) {}
+};
+
+// Buffer of up to capacity bytes, followed by padding zero bytes,
+// like a network receive buffer
+class padded_buffer {
+public:
+    inline explicit padded_buffer(uint32_t capacity);
+    inline ~padded_buffer();
+    padded_buffer(const padded_buffer&) = delete;
+    padded_buffer& operator=(const padded_buffer&) = delete;
+
+    char* data() { return buf; }
+    const char* data() const { return buf; }
+    uint32_t size() const { return len; }
+    uint32_t capacity() const { return cap; }
+
+    // Set the size, after writing up to capacity bytes to data()
+    inline void resize(uint32_t n);
+
+    // Copy n <= capacity bytes
+    inline void assign(const char* s, uint32_t n);
+
+    operator padded_view() const { return padded_view(buf, len); }
+
+private:
+    char* buf;
+    uint32_t len;
+    uint32_t cap;
+};
+
+#if SWAR_X86
+// Find char in padded string, 16 bytes at a time, from s.
+// No alignment, and no masking of the first or last block
+TARGET("sse2")
+inline uint32_t _memchr_pad16(padded_view s, uint8_t c);
+
+// Find char in padded string, 32 bytes at a time, from s
+TARGET("avx2")
+inline uint32_t _memchr_pad32(padded_view s, uint8_t c);
+#endif
+
+// Find char in padded string. Support all options
+template<bool Printable>
+inline uint32_t _memchr_pad(padded_view s, uint8_t c);
+
+// Find char in binary padded string
+inline uint32_t memchr(padded_view s, uint8_t c);
+
+// Find char in printable padded string
+inline uint32_t pmemchr(padded_view s, uint8_t c);
+
+// Find zero byte in binary padded string, or len if there is none.
+// Like strnlen
+inline uint32_t strlen(padded_view s);
+
+// Find zero byte in printable padded string, or len if there is none
+inline uint32_t pstrlen(padded_view s);
+
+// Parse uint64_t from padded string of up to 20 chars
+inline uint64_t atou(padded_view s);
+
+// Parse _signed_ int from padded string of up to 20 chars. No spaces
+inline int64_t atoi(padded_view s);
+
+//
+// ASCII case. Only A-Z and a-z change, other bytes, and bytes >= 128, stay
+//
+
+// Convert word x to lower case
+inline uint64_t _tolower8w(uint64_t x);
+
+// Convert word x to upper case
+inline uint64_t _toupper8w(uint64_t x);
+
+// Convert 8 chars to lower case, from s to d. s and d may be the same
+inline void tolower8(const char* s, char* d);
+
+// Convert 8 chars to upper case, from s to d. s and d may be the same
+inline void toupper8(const char* s, char* d);
+
+// Convert string to lower or upper case, from s to d, a word at a time.
+// s and d may be the same, and must not overlap otherwise
+template<bool Upper>
+inline void _tocase(const char* s, uint32_t len, char* d);
+
+// Convert string to lower case, from s to d. s and d may be the same.
+// Writes exactly len bytes
+inline void tolower(const char* s, uint32_t len, char* d);
+
+// Convert string to upper case, from s to d. s and d may be the same.
+// Writes exactly len bytes
+inline void toupper(const char* s, uint32_t len, char* d);
+
+// Are the first len <= 8 chars of a and b equal, ignoring case?
+inline bool eq8_ci(const char* a, const char* b, uint32_t len);
+
+// Are len chars of a and b equal, ignoring case?
+inline bool eq_ci(const char* a, const char* b, uint32_t len);
+
+// Find char, in either case, in binary string
+inline uint32_t memchr_ci(const char* s, uint32_t len, uint8_t c);
+
+// Find char, in either case, in printable string
+inline uint32_t pmemchr_ci(const char* s, uint32_t len, uint8_t c);
+
+//// Short string compare
+
+// Compare 2 words as strings, byte 0 first: -1, 0 or 1
+inline int _cmp8w(uint64_t x, uint64_t y);
+
+// Are the first len <= 8 chars of a and b equal?
+inline bool eq8(const char* a, const char* b, uint32_t len);
+
+// Are the first len <= 16 chars of a and b equal?
+inline bool eq16(const char* a, const char* b, uint32_t len);
+
+// Compare strings of up to 8 chars, like memcmp and then the lengths.
+// Negative, 0 or positive. Branchless
+inline int cmp8(const char* a, uint32_t alen, const char* b, uint32_t blen);
+
+// Compare strings of up to 16 chars, like memcmp and then the lengths.
+// Negative, 0 or positive. Branchless
+inline int cmp16(const char* a, uint32_t alen, const char* b, uint32_t blen);
+
 //// string to int
 
 // Parse uint from string of up to 4 chars
-inline uint16_t atou4(const char* s, uint32_t len);
+constexpr uint16_t atou4(const char* s, uint32_t len);
 
 // Parse uint from string of up to 8 chars
-inline uint32_t atou8(const char* s, uint32_t len);
+constexpr uint32_t atou8(const char* s, uint32_t len);
+
+// Parse uint from the first len chars in word x
+constexpr uint32_t _atou8w(uint64_t x, uint32_t len);
 
 // Parse uint64_t from string of up to 20 chars
 // *** More than 20 char returns junk.
-inline uint64_t atou(const char* s, uint32_t len);
+constexpr uint64_t atou(const char* s, uint32_t len);
 
 // Parse _signed_ int from string of up to 20 chars. No spaces
-inline int64_t atoi(const char* s, uint32_t len);
+constexpr int64_t atoi(const char* s, uint32_t len);
+
+// Parse uint of up to 16 chars, as 2 blocks of 8
+constexpr uint64_t _atou16(const char* s, uint32_t len);
+
+// Parse unsigned __int128 from string of up to 39 chars
+// *** More than 2^128 - 1 returns junk
+constexpr unsigned __int128 atou128(const char* s, uint32_t len);
+
+// Parse signed __int128 from string of up to 39 digits, and a sign
+constexpr __int128 atoi128(const char* s, uint32_t len);
+
+#if SWAR_X86
+// Fields at the end of a batch of n, where the 16 byte load from the last
+// lv digits would read more than 7 bytes past the end of the last field
+inline size_t _atou_batch_tail(size_t stride, uint32_t lv, size_t n);
+
+// Parse n uints of len <= 8 chars, 4 at a time, with SSE4.1
+TARGET("sse4.1")
+inline void _atou8_batch16(const char* base, size_t stride, uint32_t len, uint32_t* out, size_t n);
+
+// Parse n uints of len <= 8 chars, 8 at a time, with AVX2
+TARGET("avx2")
+inline void _atou8_batch32(const char* base, size_t stride, uint32_t len, uint32_t* out, size_t n);
+
+// Parse n uint64_t's of len <= 20 chars, 2 at a time, with SSE4.1
+TARGET("sse4.1")
+inline void _atou_batch16(const char* base, size_t stride, uint32_t len, uint64_t* out, size_t n);
+
+// Parse n uint64_t's of len <= 20 chars, 4 at a time, with AVX2
+TARGET("avx2")
+inline void _atou_batch32(const char* base, size_t stride, uint32_t len, uint64_t* out, size_t n);
+#endif
+
+// Parse n uints of len <= 8 chars, at base, base + stride, etc.
+// Like atou8, reads 8 bytes per field
+inline void atou8_batch(const char* base, size_t stride, uint32_t len, uint32_t* out, size_t n);
+
+// Parse n uint64_t's of len <= 20 chars, at base, base + stride, etc.
+// Like atou, reads whole words up to 7 bytes past the end of the last field.
+// The fields before it are read 16 bytes at a time, from their last 16
+// digits, so a field shorter than 9 is read into the fields after it
+inline void atou_batch(const char* base, size_t stride, uint32_t len, uint64_t* out, size_t n);
 
 // Parse hex int from string of up to 8 chars
-inline uint32_t htou8(const char* s, uint32_t len);
+constexpr uint32_t htou8(const char* s, uint32_t len);
+
+// Parse hex int from the first len chars in word x
+constexpr uint32_t _htou8w(uint64_t x, uint32_t len);
 
 // Parse hex int from string of up to 16 chars
-inline uint64_t htou(const char* s, uint32_t len);
+constexpr uint64_t htou(const char* s, uint32_t len);
+
+//// string to int, length found while parsing
+// *** Like from_chars. Read whole words, so up to 7 bytes past the digits
+
+// Set the high bit in bytes from lo to hi, and clear all other bits.
+// 1 <= lo <= hi < 128
+inline uint64_t _bytesbetween(uint64_t x, uint8_t lo, uint8_t hi);
+
+// Number of leading decimal digits in word x, up to 8
+inline uint32_t _digits8(uint64_t x);
+
+// Number of leading hex digits in word x, up to 8
+inline uint32_t _hexdigits8(uint64_t x);
+
+// Parse uint64_t from the leading digits of [s, end).
+// Returns the end of the digits, or s, and out unchanged, if there are none.
+// Out of range saturates to UINT64_MAX, like strtoull
+inline const char* parse_uint(const char* s, const char* end, uint64_t& out);
+
+// Parse _signed_ int64_t from [s, end). Optional '-' or '+'.
+// Returns the end of the digits, or s, and out unchanged, if there are none.
+// Out of range saturates to INT64_MIN or INT64_MAX
+inline const char* parse_int(const char* s, const char* end, int64_t& out);
+
+// Parse hex uint64_t from the leading hex digits of [s, end).
+// Returns the end of the digits, or s, and out unchanged, if there are none.
+// Out of range saturates to UINT64_MAX
+inline const char* parse_hex(const char* s, const char* end, uint64_t& out);
+
+//// Checked string to int
+// *** out is set only on parse_ok
+
+enum parse_error {
+    parse_ok = 0,
+    parse_invalid,  // empty, or not a digit
+    parse_overflow, // does not fit in the result
+    parse_inexact,  // more decimals than the scale
+};
+
+// Parse uint from string of up to 8 chars.
+// Set bits in bad if any is not a digit
+inline uint32_t _atou8c(const char* s, uint32_t len, uint64_t& bad);
+
+// Parse uint from string of 1 to 8 chars, or fail
+inline parse_error atou8_checked(const char* s, uint32_t len, uint32_t& out);
+
+// Parse uint64_t from string of 1 to 20 chars, or fail
+// *** More than 20 chars is parse_overflow, even with leading zeros
+inline parse_error atou_checked(const char* s, uint32_t len, uint64_t& out);
+
+// Parse _signed_ int64_t from string, or fail. Optional '-' or '+'. No spaces
+// *** More than 20 digits is parse_overflow, even with leading zeros
+inline parse_error atoi_checked(const char* s, uint32_t len, int64_t& out);
+
+// Parse hex uint64_t from string of 1 to 16 chars, or fail
+// *** More than 16 chars is parse_overflow, even with leading zeros
+inline parse_error htou_checked(const char* s, uint32_t len, uint64_t& out);
 
 //// int to string
 
 // *** p suffix means zero-padded
 
 // Convert uint, of less than 100, to %02u, as int 16
-inline uint16_t utoa2p(uint64_t x);
+constexpr uint16_t utoa2p(uint64_t x);
 
 // Convert uint, of less than 100, to %02u
-inline void utoa2p(uint64_t x, char* s);
+constexpr void utoa2p(uint64_t x, char* s);
 
 // Convert uint to %0<N>u, N <= 8
 template <int N>
-inline uint64_t _utoap(uint64_t x, char* s);
+constexpr uint64_t _utoap(uint64_t x, char* s);
+
+#if SWAR_X86
+// Convert uint to %0<N>u, 8 < N <= 20, with SSE2.
+// Up to 16 digits are converted and stored at once
+template <int N>
+TARGET("sse2")
+inline void _utoapv(uint64_t x, char* s);
+#endif
 
-// Convert uint to %0<N>u, N <= 20
+// Convert uint, of less than 10^N, to %0<N>u, N <= 20
 template <int N>
-inline char* utoap(uint64_t x, char* s);
+constexpr char* utoap(uint64_t x, char* s);
+
+// Number of decimal digits in x. 1 for 0
+constexpr uint32_t _declen(uint64_t x);
+
+// Convert uint, of less than 10^8, to %08u, as int 64
+constexpr uint64_t _utoa8w(uint32_t x);
+
+// Convert uint64_t to string. String buffer is at least 21 bytes.
+// Constant cost per 8 digits, one branch on their count. Returns length
+constexpr uint32_t utoa(uint64_t x, char* buf);
 
-// Convert signed int 32 to string of up to 8 bytes.
-inline uint32_t itoa8(int32_t x, char* buf);
+// Convert signed int 32, of less than 10^8, to string of up to 8 digits.
+// String buffer is at least 10 bytes. Returns length
+constexpr uint32_t itoa8(int32_t x, char* buf);
 
 // Convert signed int 64 to string. String buffer is at least 22 bytes.
 // Returns length
-// *** this feels inefficient :( ***
-inline uint32_t itoa(int64_t x, char* buf);
+constexpr uint32_t itoa(int64_t x, char* buf);
 
-//// Double to string
+// High 128 bits of the 256 bit product a * b
+constexpr unsigned __int128 _mulhi128(unsigned __int128 a, unsigned __int128 b);
+
+// Divide by 10^16, with a reciprocal multiply
+constexpr unsigned __int128 _div1e16(unsigned __int128 x);
+
+// Convert unsigned __int128 to string. String buffer is at least 40 bytes.
+// Constant cost per 16 digits. Returns length
+constexpr uint32_t utoa128(unsigned __int128 x, char* buf);
+
+// Convert signed __int128 to string. String buffer is at least 41 bytes.
+// Returns length
+constexpr uint32_t itoa128(__int128 x, char* buf);
+
+//// int to hex string
+
+// *** Upper means A-F, instead of a-f
+
+// Convert uint32 to %08x, or %08X, as int 64
+template <bool Upper = false>
+inline uint64_t _utoh8w(uint32_t x);
+
+// Convert uint32 to %08x, or %08X if Upper
+template <bool Upper = false>
+inline char* utoh8p(uint32_t x, char* s);
+
+// Convert uint32 to %x, or %X if Upper. String buffer is at least 9 bytes.
+// Returns length
+template <bool Upper = false>
+inline uint32_t utoh8(uint32_t x, char* buf);
+
+// Convert uint64 to %016lx, or %016lX if Upper
+template <bool Upper = false>
+inline char* utohp(uint64_t x, char* s);
+
+// Convert uint64 to %lx, or %lX if Upper. String buffer is at least 17 bytes.
+// One branch on the number of words. Returns length
+template <bool Upper = false>
+inline uint32_t utoh(uint64_t x, char* buf);
+
+// Write 4 bytes of hex from word w, each followed by a space, as 12 chars.
+// Writes 14 bytes
+inline void _hexdump4(uint64_t w, char* d);
+
+// Write one line of hexdump for n <= 16 bytes in 16 byte buffer p.
+// Writes up to 79 bytes. Returns the line length
+inline uint32_t _hexdump16(const char* p, uint32_t n, uint32_t off, char* d);
+
+// Format bytes like hexdump -C, 16 per line, without snprintf.
+// "00000010  72 6c 64 0a                                       |rld.|"
+// Does not fold repeated lines to '*', nor end with the total length.
+// buf is at least 79 bytes per 16 bytes, rounded up, plus 1. Returns length
+inline size_t hexdump(const void* p, size_t len, char* buf);
+
+//// String to double
 
 // Copy the sign from src to dst that is unsigned.
 // *** dst is up to 63 bit
 inline int64_t _copySign(int64_t src, uint64_t dst);
 
-// Parse double from string
-// *** More than 20 char integer part returns junk.
-// *** Too much decimal char will get lost to precision
+// Add the leading digits of [p, end) to w. More than 19 digits wrap.
+// Returns the end of the digits
+inline const char* _atod_digits(const char* p, const char* end, uint64_t& w);
+
+// Count the up to 8 digits of a fraction at f, in n.
+// Returns false if there may be more
+inline bool _atod_frac8(const char* f, const char* end, uint32_t& n);
+
+// Add the leading digits of [p, end) to w, up to 19 significant digits.
+// Digits past that are counted in dropped, and set trunc if not all '0'.
+// Returns the end of the digits
+inline const char* _atod_digits(const char* p, const char* end, uint64_t& w,
+                                uint32_t& nd, uint32_t& dropped, bool& trunc);
+
+// Correctly rounded w * 10^q, as the bits of a positive double.
+// Returns -1 if the 128 bit product is not enough to tell.
+// 1 <= w, -342 <= q <= 308
+inline int64_t _eisel_lemire(uint64_t w, int32_t q);
+
+// Parse double with strtod. For the rare cases _eisel_lemire can't tell
+inline double _atod_slow(const char* s, uint32_t len);
+
+// Parse double from string. Correctly rounded.
+// [+-] digits [. digits] [e|E [+-] digits], inf, infinity or nan.
+// Anything after the number is ignored, no number returns 0.
+// *** The rare fallback for more than 19 digits uses strtod, so the
+// *** C locale is assumed
 inline double atod(const char* s, uint32_t len);
 
+//// String to fixed point
+
+// Parse decimal string to int64_t ticks of 10^-Scale, without double.
+// "123.4567" --> 1234567 at Scale 4. Optional '-' or '+'.
+// Decimals past Scale are rounded half away from zero.
+// *** More than 20 char integer part returns junk, like atou
+template <int Scale>
+inline int64_t atofixed(const char* s, uint32_t len);
+
+// Parse decimal string to int64_t ticks of 10^-Scale, or fail.
+// Like atofixed, but decimals past Scale must be '0', or it is
+// parse_inexact
+template <int Scale>
+inline parse_error atofixed_checked(const char* s, uint32_t len, int64_t& out);
+
+//// Fixed point to string
+
+// Convert int64_t ticks of 10^-Scale to string, like "-123.4500" at
+// Scale 4. Exactly Scale decimals, or without trailing zeros if Trim, and
+// without the dot if there are none left. 1 <= Scale <= 8.
+// Buffer is at least 32 bytes, written in whole words. Returns length
+template <int Scale, bool Trim = false>
+inline uint32_t fixedtoa(int64_t ticks, char* buf);
+
+//// Double to string
+
+// Shortest decimal f * 10^k that parses back to the double of bits.
+// Finite and not 0
+inline void _schubfach(uint64_t bits, uint64_t& f, int32_t& k);
+
+// Write the decimal digits of f in d[0, 24), zero padded on the left.
+// Returns the first of the n digits. d is at least 48 bytes
+inline const char* _dtoa_digits(uint64_t f, uint32_t n, char* d);
+
+// Convert double to the shortest string that parses back to it.
+// Like JavaScript: 123.45, 0.000012, 1.5e+21 or 1e-7, and inf, nan.
+// Buffer is at least 32 bytes, written in whole words. Returns length
+inline uint32_t dtoa(double x, char* buf);
+
+// Longest dtoa<N>, of -1.7976931348623157e308 with 17 decimals, and the
+// NUL
+const uint32_t dtoa_fixed_max = 329;
+
+// Write x * 10^N, that is 2^64 or more and less than 2^128, as %.<N>f
+template <int N>
+inline uint32_t _dtoa_fixed128(bool neg, unsigned __int128 t, char* buf);
+
+// Write x as %.<N>f with snprintf, for x * 10^N of 2^128 or more
+template <int N>
+inline uint32_t _dtoa_printf(double x, char* buf);
+
+// Convert double to %.<N>f, N <= 17. Rounded like printf, half way to
+// even of the exact value.
+// *** inf and nan are written as dtoa(x)
+// Buffer is at least 32 bytes, written in whole words, while
+// |x| * 10^N < 2^64. Larger values take up to dtoa_fixed_max bytes.
+// Returns length
+template <int N>
+inline uint32_t dtoa(double x, char* buf);
+
+//// Timestamps
+// *** FIX UTCTimestamp layout, YYYYMMDD-HH:MM:SS[.sss[sss[sss]]], to and
+// *** from int64_t nanoseconds since 1970-01-01, UTC, up to 2262-04-11
+
+// Days since 1970-01-01 of a date in the proleptic Gregorian calendar.
+// Year 1 to 9999
+inline int64_t _days_from_civil(uint32_t y, uint32_t m, uint32_t d);
+
+// Date of days since 1970-01-01, days >= 0
+inline void _civil_from_days(uint32_t days, uint32_t& y, uint32_t& m, uint32_t& d);
+
+// Parse YYYYMMDD-HH:MM:SS, with 0 to 9 decimals, to epoch nanoseconds.
+// len is 17 for no decimals, else 18 + decimals.
+// Reads whole words, like atou8, up to 7 bytes past the end
+inline int64_t parse_timestamp(const char* s, uint32_t len);
+
+// Convert epoch nanoseconds, ns >= 0, to YYYYMMDD-HH:MM:SS, with Digits
+// decimals, truncated. 0 <= Digits <= 9, like 3 for milliseconds.
+// Buffer is at least 32 bytes, written in whole words. Returns length
+template <int Digits = 0>
+inline uint32_t format_timestamp(int64_t ns, char* buf);
+
 } // namespace swar
@@ -5,6 +5,12 @@
 #include <assert.h>
 #include <string.h> // for memcpy, memset
 #include <stdint.h>
+#include <stdio.h> // for snprintf
+#include <stdlib.h> // for strtod, malloc
+
+#if SWAR_X86
+#include <immintrin.h>
+#endif
 
 // Function naming convention [prefix] <function> [length]
 // - function
@@ -13,50 +19,56 @@ namespace swar {
 
 // cast and fill utils
 template <typename T>
-inline T cast(const char* src) {
-    T ret;
+constexpr T cast(const char* src) {
+    T ret = 0;
+    if (SWAR_IS_CONSTANT_EVALUATED()) {
+        // No memcpy at compile time. Little endian, like x86
+        for (uint32_t i = 0; i < sizeof(T); i++)
+            ret |= (T)(uint8_t)src[i] << (i * 8);
+        return ret;
+    }
     ::memcpy(&ret, src, sizeof(T));
     return ret;
 }
 
+// ~0 / 0xff is 0x0101...01
 template <typename T>
-inline T extend(char c) {
-    T ret;
-    ::memset(&ret, c, sizeof(T));
-    return ret;
+constexpr T extend(char c) {
+    return (T)~(T)0 / 0xff * (uint8_t)c;
+}
+
+// Store T to char* using memcpy. memcpy is optimized away on x86
+template <typename T>
+constexpr void _store(char* dst, T x) {
+    if (SWAR_IS_CONSTANT_EVALUATED()) {
+        for (uint32_t i = 0; i < sizeof(T); i++)
+            dst[i] = (char)(x >> (i * 8));
+        return;
+    }
+    ::memcpy(dst, &x, sizeof(T));
 }
 
 // swap bytes
-inline uint64_t bswap(uint64_t x) { return __builtin_bswap64(x); }
-inline uint32_t bswap(uint32_t x) { return __builtin_bswap32(x); }
-inline uint16_t bswap(uint16_t x) { return __builtin_bswap16(x); }
+constexpr uint64_t bswap(uint64_t x) { return __builtin_bswap64(x); }
+constexpr uint32_t bswap(uint32_t x) { return __builtin_bswap32(x); }
+constexpr uint16_t bswap(uint16_t x) { return __builtin_bswap16(x); }
 
 //// Find bytes
 
-inline bool haszero(uint64_t x) {
+constexpr bool haszero(uint64_t x) {
     uint64_t a = 0x7f7f7f7f7f7f7f7full;
     uint64_t l = 0x0101010101010101ull;
     return (x - l) & ~x & ~a;
 }
 
 // Check if word has some byte
-inline bool hasbyte(uint64_t x, uint8_t c) {
+constexpr bool hasbyte(uint64_t x, uint8_t c) {
     return haszero(x ^ extend<uint64_t>(c));
 }
 
-// Find char in string. Support all options.
-template<bool Printable, bool Exists, bool Reverse=false>
-inline uint32_t _memchr8(const char* s, uint8_t c) {
-    // int 64 of all c's
-    uint64_t m = extend<uint64_t>(c);
-
-    // int 64 of s
-    uint64_t x = cast<uint64_t>(s);
-
-    // remove c's from string
-    // so now we have to find first zero byte
-    x ^= m;
-
+// Set the high bit in zero bytes, and clear all other bits
+template<bool Printable>
+constexpr uint64_t _zerobytes(uint64_t x) {
     uint64_t a = 0x7f7f7f7f7f7f7f7full;
 
     // set the high bit in non-zero bytes
@@ -71,8 +83,13 @@ inline uint32_t _memchr8(const char* s, uint8_t c) {
     x = ~x;
 
     // clear all bits except the high bit of the zero byte
-    x &= ~a;
+    return x & ~a;
+}
 
+// Find the first, or last, byte with the high bit set.
+// x has only high bits set, like _zerobytes returns
+template<bool Exists, bool Reverse>
+constexpr uint32_t _bytepos(uint64_t x) {
     // find the high bit, from right (little endian)
     if (Exists) {
         if (!Reverse) {
@@ -97,6 +114,27 @@ inline uint32_t _memchr8(const char* s, uint8_t c) {
     }
 }
 
+// Mask of the low n bytes, n <= 8
+constexpr uint64_t _bytesmask(uint32_t n) {
+    return (n < 8 ? 1ull << (n * 8) : 0ull) - 1;
+}
+
+// Find char in string. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+constexpr uint32_t _memchr8(const char* s, uint8_t c) {
+    // int 64 of all c's
+    uint64_t m = extend<uint64_t>(c);
+
+    // int 64 of s
+    uint64_t x = cast<uint64_t>(s);
+
+    // remove c's from string
+    // so now we have to find first zero byte
+    x ^= m;
+
+    return _bytepos<Exists, Reverse>(_zerobytes<Printable>(x));
+}
+
 // Find char in string and trim it
 template<bool Printable, bool Exists>
 inline uint32_t _trim8(const char* s, uint8_t c) {
@@ -143,278 +181,1519 @@ inline uint32_t _trim8(const char* s, uint8_t c) {
 }
 
 // Find char in printable (chars < 128) string of 8 chars
-inline uint32_t pmemchr8(const char* s, uint8_t c) {
+constexpr uint32_t pmemchr8(const char* s, uint8_t c) {
     return _memchr8<true, false>(s, c);
 }
 
 // Find char in printable (chars < 128) string of 8 chars
 // * The string is known to contain the char
-inline uint32_t pmemchr8k(const char* s, uint8_t c) {
+constexpr uint32_t pmemchr8k(const char* s, uint8_t c) {
     return _memchr8<true, true>(s, c);
 }
 
 // Find char in binary string of 8 chars
-inline uint32_t memchr8(const char* s, uint8_t c) {
+constexpr uint32_t memchr8(const char* s, uint8_t c) {
     return _memchr8<false, false>(s, c);
 }
 
 // Find char in binary string of 8 chars
 // * The string is known to contain the char
-inline uint32_t memchr8k(const char* s, uint8_t c) {
+constexpr uint32_t memchr8k(const char* s, uint8_t c) {
     return _memchr8<false, true>(s, c);
 }
 
 // Find char in printable (chars < 128) string of 8 chars
-inline uint32_t pmemrchr8(const char* s, uint8_t c) {
+constexpr uint32_t pmemrchr8(const char* s, uint8_t c) {
     return _memchr8<true, false, true>(s, c);
 }
 
 // Find char in printable (chars < 128) string of 8 chars
 // * The string is known to contain the char
-inline uint32_t pmemrchr8k(const char* s, uint8_t c) {
+constexpr uint32_t pmemrchr8k(const char* s, uint8_t c) {
     return _memchr8<true, true, true>(s, c);
 }
 
 // Find char in binary string of 8 chars
-inline uint32_t memrchr8(const char* s, uint8_t c) {
+constexpr uint32_t memrchr8(const char* s, uint8_t c) {
     return _memchr8<false, false, true>(s, c);
 }
 
 // Find char in binary string of 8 chars
 // * The string is known to contain the char
-inline uint32_t memrchr8k(const char* s, uint8_t c) {
+constexpr uint32_t memrchr8k(const char* s, uint8_t c) {
     return _memchr8<false, true, true>(s, c);
 }
 
+// Find char, or last char, in const string, with aligned words only.
+// No read crosses a page the string does not cross.
+// Bytes before s, and past len, are replaced with c ^ 1, that is not c,
+// and is still printable if c is
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _amemchr(const char* s, uint32_t len, uint8_t c) {
+    if (!Known && len == 0)
+        return -1;
+
+    uint64_t m = extend<uint64_t>(c);
+    uint64_t other = m ^ 0x0101010101010101ull;
+    const char* end = s + len;
+    const char* first = (const char*)((uintptr_t)s & ~(uintptr_t)7);
+    const char* last = (const char*)((uintptr_t)(end - 1) & ~(uintptr_t)7);
+
+    // The string bytes of the words with s, and with end - 1
+    uint64_t head = ~_bytesmask(s - first);
+    uint64_t tail = _bytesmask(end - last);
+
+    // Known going forward can skip the end, as c is before it
+    const bool stopped = Reverse || !Known;
+    const char* p = Reverse ? last : first;
+    const char* stop = Reverse ? first : last;
+
+    // First word
+    uint64_t keep = p == stop ? head & tail : Reverse ? tail : head;
+    uint64_t x = (cast<uint64_t>(p) & keep) | (other & ~keep);
+    uint64_t bits = _zerobytes<Printable>(x ^ m);
+    if (!Known && !bits && p == stop)
+        return -1;
+
+    // Whole words, and the last, partial, word
+    while (!bits) {
+        p += Reverse ? -8 : 8;
+        x = cast<uint64_t>(p);
+        if (stopped && p == stop) {
+            keep = Reverse ? head : tail;
+            x = (x & keep) | (other & ~keep);
+            bits = _zerobytes<Printable>(x ^ m);
+            if (!Known && !bits)
+                return -1;
+            break;
+        }
+        bits = _zerobytes<Printable>(x ^ m);
+    }
+
+    return (p - s) + _bytepos<true, Reverse>(bits);
+}
+
 // Find char in const binary string
-template<bool Printable, bool Known>
+template<bool Printable, bool Known, bool Aligned>
 inline uint32_t _memchr(const char* s, uint32_t len, uint8_t c) {
+    if (Aligned)
+        return _amemchr<Printable, Known, false>(s, len, c);
+
     const char* p = s;
     const char* end = s + len;
 
-    // If shorter than 8 bytes, we have to mask away c bytes past len
-    uint32_t partLen = (len & 7) ? (len & 7) : 8;
-    uint64_t partMask = len < 8 ? ~0ull >> (64 - partLen * 8) : 0ull;
-    uint64_t first = cast<uint64_t>(p) & ~(partMask & extend<uint64_t>(c));
+    // The first c in memory is the one in the string, so there is nothing
+    // to mask, and no need for len
+    if (Known) {
+        while (!hasbyte(cast<uint64_t>(p), c)) {
+            p += 8;
+        }
+        return (p - s) + _memchr8<Printable, true>(p, c);
+    }
+
+    // Check the first, possibly partial, word.
+    // Matches past partLen belong to the next word or are past len
+    uint32_t partLen = len ? ((len - 1) & 7) + 1 : 0;
+    uint32_t first = _memchr8<Printable, false>(p, c);
+    if (first < partLen)
+        return first;
 
-    // Check first 8 bytes
-    if (hasbyte(first, c))
-        return _memchr8<Printable, true>((char*)&first, c);
-    
     // Advance to leave multiple of 8 bytes
     p += partLen;
 
     // Check words for that byte
     for (;;) {
+        if (p == end)
+            return -1;
         if (hasbyte(cast<uint64_t>(p), c)) {
             return (p - s) + _memchr8<Printable, true>(p, c);
         }
         p += 8;
-        if (!Known) {
-            if (p == end)
-                return -1;
-        }
     }
 }
 
 // Find char, in reverse, in const binary string
-template<bool Printable, bool Known>
+template<bool Printable, bool Known, bool Aligned>
 inline uint32_t _memrchr(const char* s, uint32_t len, uint8_t c) {
+    if (Aligned)
+        return _amemchr<Printable, Known, true>(s, len, c);
+
     const char* p = s + len;
 
-    // If shorter than 8 bytes, we have to mask away c bytes past len
-    uint32_t partLen = (len & 7) ? (len & 7) : 8;
-    uint64_t partMask = len < 8 ? ~0ull >> (64 - partLen * 8) : 0ull;
-    uint64_t first = cast<uint64_t>(p) & ~(partMask & extend<uint64_t>(c));
+    // Check whole words from the end
+    while (p - s >= 8) {
+        p -= 8;
+        if (hasbyte(cast<uint64_t>(p), c)) {
+            return (p - s) + _memchr8<Printable, true, true>(p, c);
+        }
+    }
+
+    // Check the first partLen bytes. Replace the bytes past partLen with
+    // c ^ 1, that is not c, and is still printable if c is
+    uint32_t partLen = p - s;
+    uint64_t partMask = (1ull << (partLen * 8)) - 1;
+    uint64_t first = (cast<uint64_t>(s) & partMask) |
+                     (extend<uint64_t>(c ^ 1) & ~partMask);
 
-    // Advance to leave multiple of 8 bytes
-    p -= partLen;
+    return _memchr8<Printable, Known, true>((char*)&first, c);
+}
+
+//// Generic scanners.
+// The matcher M tells which bytes match:
+//  m8  sets the high bit of matching bytes in a word, and clears other bits
+//  m16 returns the movemask of matching bytes in an aligned 16 byte block
+//  m32 returns the movemask of matching bytes in an aligned 32 byte block
+//  sse2 is false if the matcher has no m16
+
+// Match one char
+template<bool Printable>
+struct _match1 {
+    uint8_t c;
+    static const bool sse2 = true;
 
-    // Check first 8 bytes
-    if (hasbyte(first, c)) {
-        return (p - s) + _memchr8<Printable, true, true>((char*)&first, c);
+    uint64_t m8(uint64_t x) const {
+        return _zerobytes<Printable>(x ^ extend<uint64_t>(c));
     }
-    
-    // Check words for that byte
+#if SWAR_X86
+    TARGET("sse2") uint32_t m16(const char* p) const {
+        __m128i x = _mm_load_si128((const __m128i*)p);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8(c)));
+    }
+    TARGET("avx2") uint32_t m32(const char* p) const {
+        __m256i x = _mm256_load_si256((const __m256i*)p);
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(c)));
+    }
+#endif
+};
+
+// Find first match in const string, word at a time
+template<bool Known, typename M>
+inline uint32_t _scan(const char* s, uint32_t len, const M& m) {
+    const char* p = s;
+    const char* end = s + len;
+    uint64_t bits;
+
+    // The first match in memory is the one in the string
+    if (Known) {
+        while (!(bits = m.m8(cast<uint64_t>(p)))) {
+            p += 8;
+        }
+        return (p - s) + _bytepos<true, false>(bits);
+    }
+
+    // Check the first, possibly partial, word
+    uint32_t partLen = len ? ((len - 1) & 7) + 1 : 0;
+    bits = m.m8(cast<uint64_t>(p)) & _bytesmask(partLen);
+    if (bits)
+        return _bytepos<true, false>(bits);
+
+    // Advance to leave multiple of 8 bytes
+    p += partLen;
+
+    // Check words
     for (;;) {
-        if (hasbyte(cast<uint64_t>(p), c)) {
-            return (p - s) + _memchr8<Printable, true, true>(p, c);
+        if (p == end)
+            return -1;
+        bits = m.m8(cast<uint64_t>(p));
+        if (bits) {
+            return (p - s) + _bytepos<true, false>(bits);
         }
+        p += 8;
+    }
+}
+
+// Find last match in const string, word at a time
+template<bool Known, typename M>
+inline uint32_t _rscan(const char* s, uint32_t len, const M& m) {
+    const char* p = s + len;
+
+    // Check whole words from the end
+    while (p - s >= 8) {
         p -= 8;
+        uint64_t bits = m.m8(cast<uint64_t>(p));
+        if (bits) {
+            return (p - s) + _bytepos<true, true>(bits);
+        }
+    }
+
+    // Check the first, partial, word
+    uint64_t bits = m.m8(cast<uint64_t>(s)) & _bytesmask(p - s);
+    return _bytepos<Known, true>(bits);
+}
+
+#if SWAR_X86
+
+// Vector width picked once, at startup, by cpuid
+inline uint32_t _cpu_vecwidth() {
+    __builtin_cpu_init();
+    if (SWAR_MAX_VECWIDTH >= 32 && __builtin_cpu_supports("avx2"))
+        return 32;
+    if (SWAR_MAX_VECWIDTH >= 16 && __builtin_cpu_supports("sse2"))
+        return 16;
+    return 8;
+}
+
+// Zero until initialized, so calls from other static initializers use SWAR
+inline const uint32_t _vecwidth = _cpu_vecwidth();
+
+// SSE4.1, for the number parsers, picked once at startup
+inline bool _cpu_sse41() {
+    __builtin_cpu_init();
+    return SWAR_MAX_VECWIDTH >= 16 && __builtin_cpu_supports("sse4.1");
+}
+
+inline const bool _sse41 = _cpu_sse41();
+
+// Find first match in const string, 16 bytes at a time.
+// Loads are aligned, so never cross a page the string does not cross
+template<bool Known, typename M>
+TARGET("sse2")
+inline uint32_t _vscan16(const char* s, uint32_t len, const M& m) {
+    if (!Known && len == 0)
+        return -1;
+
+    uint32_t off = (uintptr_t)s & 15;
+    const char* p = s - off;
+    const char* end = s + len;
+
+    // Drop matches before s
+    uint32_t bits = m.m16(p) >> off << off;
+
+    for (;;) {
         if (!Known) {
-            if (p == s)
-                return -1;
+            if (end - p <= 16) {
+                // Last block. Drop matches past len
+                bits &= (1u << (end - p)) - 1;
+                return bits ? (p - s) + __builtin_ctz(bits) : -1;
+            }
+        }
+        if (bits) {
+            return (p - s) + __builtin_ctz(bits);
+        }
+        p += 16;
+        bits = m.m16(p);
+    }
+}
+
+// Find first match in const string, 32 bytes at a time
+template<bool Known, typename M>
+TARGET("avx2")
+inline uint32_t _vscan32(const char* s, uint32_t len, const M& m) {
+    if (!Known && len == 0)
+        return -1;
+
+    uint32_t off = (uintptr_t)s & 31;
+    const char* p = s - off;
+    const char* end = s + len;
+
+    // Drop matches before s
+    uint32_t bits = m.m32(p) >> off << off;
+
+    for (;;) {
+        if (!Known) {
+            if (end - p <= 32) {
+                // Last block. Drop matches past len
+                bits &= (1ull << (end - p)) - 1;
+                return bits ? (p - s) + __builtin_ctz(bits) : -1;
+            }
+        }
+        if (bits) {
+            return (p - s) + __builtin_ctz(bits);
+        }
+        p += 32;
+        bits = m.m32(p);
+    }
+}
+
+// Find last match in const string, 16 bytes at a time
+template<bool Known, typename M>
+TARGET("sse2")
+inline uint32_t _vrscan16(const char* s, uint32_t len, const M& m) {
+    if (!Known && len == 0)
+        return -1;
+
+    const char* end = s + len;
+    const char* p = (const char*)((uintptr_t)(end - 1) & ~(uintptr_t)15);
+
+    // Drop matches past len
+    uint32_t bits = m.m16(p) & ((1u << (end - p)) - 1);
+
+    for (;;) {
+        if (!Known) {
+            if (p <= s) {
+                // First block. Drop matches before s
+                bits &= ~0u << (s - p);
+                return bits ? (p - s) + 31 - __builtin_clz(bits) : -1;
+            }
+        }
+        if (bits) {
+            return (p - s) + 31 - __builtin_clz(bits);
+        }
+        p -= 16;
+        bits = m.m16(p);
+    }
+}
+
+// Find last match in const string, 32 bytes at a time
+template<bool Known, typename M>
+TARGET("avx2")
+inline uint32_t _vrscan32(const char* s, uint32_t len, const M& m) {
+    if (!Known && len == 0)
+        return -1;
+
+    const char* end = s + len;
+    const char* p = (const char*)((uintptr_t)(end - 1) & ~(uintptr_t)31);
+
+    // Drop matches past len
+    uint32_t bits = m.m32(p) & ((1ull << (end - p)) - 1);
+
+    for (;;) {
+        if (!Known) {
+            if (p <= s) {
+                // First block. Drop matches before s
+                bits &= ~0u << (s - p);
+                return bits ? (p - s) + 31 - __builtin_clz(bits) : -1;
+            }
+        }
+        if (bits) {
+            return (p - s) + 31 - __builtin_clz(bits);
+        }
+        p -= 32;
+        bits = m.m32(p);
+    }
+}
+
+// Find char in const string, 16 bytes at a time
+template<bool Known>
+TARGET("sse2")
+inline uint32_t _memchr16(const char* s, uint32_t len, uint8_t c) {
+    return _vscan16<Known>(s, len, _match1<false>{c});
+}
+
+// Find char in const string, 32 bytes at a time
+template<bool Known>
+TARGET("avx2")
+inline uint32_t _memchr32(const char* s, uint32_t len, uint8_t c) {
+    return _vscan32<Known>(s, len, _match1<false>{c});
+}
+
+// Find char, in reverse, in const string, 16 bytes at a time
+template<bool Known>
+TARGET("sse2")
+inline uint32_t _memrchr16(const char* s, uint32_t len, uint8_t c) {
+    return _vrscan16<Known>(s, len, _match1<false>{c});
+}
+
+// Find char, in reverse, in const string, 32 bytes at a time
+template<bool Known>
+TARGET("avx2")
+inline uint32_t _memrchr32(const char* s, uint32_t len, uint8_t c) {
+    return _vrscan32<Known>(s, len, _match1<false>{c});
+}
+
+#endif // SWAR_X86
+
+// Find first match in const string. Widest path the cpu has
+template<bool Known, typename M>
+inline uint32_t _scanv(const char* s, uint32_t len, const M& m) {
+#if SWAR_X86
+    // Up to 2 words are faster with SWAR
+    if (len > 16) {
+        if (_vecwidth == 32)
+            return _vscan32<Known>(s, len, m);
+        if constexpr (M::sse2) {
+            if (_vecwidth == 16)
+                return _vscan16<Known>(s, len, m);
+        }
+    }
+#endif
+    return _scan<Known>(s, len, m);
+}
+
+// Find last match in const string. Widest path the cpu has
+template<bool Known, typename M>
+inline uint32_t _rscanv(const char* s, uint32_t len, const M& m) {
+#if SWAR_X86
+    // Up to 2 words are faster with SWAR
+    if (len > 16) {
+        if (_vecwidth == 32)
+            return _vrscan32<Known>(s, len, m);
+        if constexpr (M::sse2) {
+            if (_vecwidth == 16)
+                return _vrscan16<Known>(s, len, m);
         }
     }
+#endif
+    return _rscan<Known>(s, len, m);
+}
+
+// Find char in const string. Widest path the cpu has.
+// The vector loads are aligned, but the SWAR fallback of _scanv is not
+template<bool Printable, bool Known, bool Aligned>
+inline uint32_t _memchrv(const char* s, uint32_t len, uint8_t c) {
+#if SWAR_X86
+    if (len > 16 && (!Aligned || _vecwidth > 8)) {
+        return _scanv<Known>(s, len, _match1<Printable>{c});
+    }
+#endif
+    return _memchr<Printable, Known, Aligned>(s, len, c);
+}
+
+// Find char, in reverse, in const string. Widest path the cpu has
+template<bool Printable, bool Known, bool Aligned>
+inline uint32_t _memrchrv(const char* s, uint32_t len, uint8_t c) {
+#if SWAR_X86
+    if (len > 16 && (!Aligned || _vecwidth > 8)) {
+        return _rscanv<Known>(s, len, _match1<Printable>{c});
+    }
+#endif
+    return _memrchr<Printable, Known, Aligned>(s, len, c);
 }
 
 // Find char in binary string
+template<bool Aligned>
 inline uint32_t memchr(const char* s, uint32_t len, uint8_t c) {
-    return _memchr<false, false>(s, len, c);
+    return _memchrv<false, false, Aligned>(s, len, c);
 }
 
 // Find char in binary string. Char c is known to be in s + len
+template<bool Aligned>
 inline uint32_t memchrk(const char* s, uint32_t len, uint8_t c) {
-    return _memchr<false, true>(s, len, c);
+    return _memchrv<false, true, Aligned>(s, len, c);
 }
 
 // Find char in printable string
+template<bool Aligned>
 inline uint32_t pmemchr(const char* s, uint32_t len, uint8_t c) {
-    return _memchr<true, false>(s, len, c);
+    return _memchrv<true, false, Aligned>(s, len, c);
 }
 
 // Find char in printable string. Char c is known to be in s + len
+template<bool Aligned>
 inline uint32_t pmemchrk(const char* s, uint32_t len, uint8_t c) {
-    return _memchr<true, true>(s, len, c);
+    return _memchrv<true, true, Aligned>(s, len, c);
 }
 
 // Find char in binary string
+template<bool Aligned>
 inline uint32_t memrchr(const char* s, uint32_t len, uint8_t c) {
-    return _memrchr<false, false>(s, len, c);
+    return _memrchrv<false, false, Aligned>(s, len, c);
 }
 
 // Find char in binary string. Char c is known to be in s + len
+template<bool Aligned>
 inline uint32_t memrchrk(const char* s, uint32_t len, uint8_t c) {
-    return _memrchr<false, true>(s, len, c);
+    return _memrchrv<false, true, Aligned>(s, len, c);
 }
 
 // Find char in printable string
+template<bool Aligned>
 inline uint32_t pmemrchr(const char* s, uint32_t len, uint8_t c) {
-    return _memrchr<true, false>(s, len, c);
+    return _memrchrv<true, false, Aligned>(s, len, c);
 }
 
 // Find char in printable string. Char c is known to be in s + len
+template<bool Aligned>
 inline uint32_t pmemrchrk(const char* s, uint32_t len, uint8_t c) {
-    return _memrchr<true, true>(s, len, c);
+    return _memrchrv<true, true, Aligned>(s, len, c);
 }
 
-// Find char in NON-CONST string
-template<bool Printable>
-inline uint32_t _memchr_nc(char* s, uint32_t len, uint8_t c) {
-    const char* p = s;
+//// Find any of a few bytes
 
-    // Replace back with sentinel so we don't have to check for length
-    uint8_t back = s[len - 1];
-    s[len - 1] = c;
+// Match any of two chars
+template<bool Printable>
+struct _match2 {
+    uint8_t c1, c2;
+    static const bool sse2 = true;
 
-    // Check words for that byte.
-    while (!hasbyte(cast<uint64_t>(p), c)) {
-        p += 8;
+    uint64_t m8(uint64_t x) const {
+        return _zerobytes<Printable>(x ^ extend<uint64_t>(c1)) |
+               _zerobytes<Printable>(x ^ extend<uint64_t>(c2));
     }
+#if SWAR_X86
+    TARGET("sse2") uint32_t m16(const char* p) const {
+        __m128i x = _mm_load_si128((const __m128i*)p);
+        return _mm_movemask_epi8(_mm_or_si128(
+            _mm_cmpeq_epi8(x, _mm_set1_epi8(c1)),
+            _mm_cmpeq_epi8(x, _mm_set1_epi8(c2))));
+    }
+    TARGET("avx2") uint32_t m32(const char* p) const {
+        __m256i x = _mm256_load_si256((const __m256i*)p);
+        return _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c1)),
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c2))));
+    }
+#endif
+};
 
-    // Find the position
-    p += _memchr8<Printable, true>(p, c);
-
-    // restore sentinel
-    s[len - 1] = back;
+// Match any of three chars
+template<bool Printable>
+struct _match3 {
+    uint8_t c1, c2, c3;
+    static const bool sse2 = true;
+
+    uint64_t m8(uint64_t x) const {
+        return _zerobytes<Printable>(x ^ extend<uint64_t>(c1)) |
+               _zerobytes<Printable>(x ^ extend<uint64_t>(c2)) |
+               _zerobytes<Printable>(x ^ extend<uint64_t>(c3));
+    }
+#if SWAR_X86
+    TARGET("sse2") uint32_t m16(const char* p) const {
+        __m128i x = _mm_load_si128((const __m128i*)p);
+        return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(
+            _mm_cmpeq_epi8(x, _mm_set1_epi8(c1)),
+            _mm_cmpeq_epi8(x, _mm_set1_epi8(c2))),
+            _mm_cmpeq_epi8(x, _mm_set1_epi8(c3))));
+    }
+    TARGET("avx2") uint32_t m32(const char* p) const {
+        __m256i x = _mm256_load_si256((const __m256i*)p);
+        return _mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c1)),
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c2))),
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c3))));
+    }
+#endif
+};
 
-    uint32_t ret = p - s;
-    return (ret != len - 1 || back == c) ? ret : -1;
+// Set of bytes, as a 256 bit bitmap
+inline byteset::byteset() {
+    memset(this, 0, sizeof(*this));
 }
 
-// Find char in binary NON-CONST string
-inline uint32_t memchr_nc(char* s, uint32_t len, uint8_t c) {
-    return _memchr_nc<false>(s, len, c);
+inline byteset::byteset(const char* chars, uint32_t len) {
+    memset(this, 0, sizeof(*this));
+    for (uint32_t i = 0; i < len; i++) {
+        add(chars[i]);
+    }
 }
 
-// Find char in printable NON-CONST string
-inline uint32_t pmemchr_nc(char* s, uint32_t len, uint8_t c) {
-    return _memchr_nc<true>(s, len, c);
-}
+inline void byteset::add(uint8_t c) {
+    bits[c >> 6] |= 1ull << (c & 63);
 
-// Find zero byte in binary string up to 8 chars
-inline uint32_t strlen8(const char* s) {
-    return memchr8(s, 0);
+    // Same bit, split by nibbles, for pshufb lookup
+    uint8_t* t = c < 128 ? lo : hi;
+    t[c & 15] |= 1u << ((c >> 4) & 7);
 }
 
-// Find zero byte in printable string up to 8 chars
-inline uint32_t pstrlen8(const char* s) {
-    return pmemchr8(s, 0);
+inline bool byteset::has(uint8_t c) const {
+    return (bits[c >> 6] >> (c & 63)) & 1;
 }
 
-// Find zero byte in binary string
-inline uint32_t strlen(const char* s) {
-    // check words for zero
-    const char* p = s;
-    while (!haszero(cast<uint64_t>(p))) {
-        p += 8;
+// Match any char in a byteset
+template<bool Printable>
+struct _matchset {
+    const byteset& set;
+    static const bool sse2 = false;
+
+    uint64_t m8(uint64_t x) const {
+        // No SWAR trick for a set. Test each byte in the bitmap
+        uint64_t ret = 0;
+        for (int i = 0; i < 64; i += 8) {
+            uint8_t b = x >> i;
+            b &= Printable ? 0x7f : 0xff;
+            ret |= (uint64_t)set.has(b) << (i + 7);
+        }
+        return ret;
+    }
+#if SWAR_X86
+    // Look up the low nibble, in lo for bytes < 128 and hi for the rest.
+    // The result holds the bits of all high nibbles of that low nibble
+    // in the set. Then test the bit of the actual high nibble
+    TARGET("avx2") uint32_t m32(const char* p) const {
+        __m256i x = _mm256_load_si256((const __m256i*)p);
+        __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)set.lo));
+        __m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)set.hi));
+        __m256i nibbits = _mm256_setr_epi8(
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+        // pshufb gives zero for index with the high bit set
+        __m256i t = _mm256_or_si256(
+            _mm256_shuffle_epi8(lo, x),
+            _mm256_shuffle_epi8(hi, _mm256_xor_si256(x, _mm256_set1_epi8(-128))));
+
+        __m256i h = _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(7));
+        __m256i b = _mm256_shuffle_epi8(nibbits, h);
+
+        __m256i miss = _mm256_cmpeq_epi8(_mm256_and_si256(t, b), _mm256_setzero_si256());
+        return ~_mm256_movemask_epi8(miss);
     }
+#endif
+};
+
+// Find any of 2 chars in a string of 8 chars. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+inline uint32_t _memchr8(const char* s, uint8_t c1, uint8_t c2) {
+    _match2<Printable> m = {c1, c2};
+    return _bytepos<Exists, Reverse>(m.m8(cast<uint64_t>(s)));
+}
 
-    return p - s + memchr8k(p, 8);
+// Find any of 3 chars in a string of 8 chars. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+inline uint32_t _memchr8(const char* s, uint8_t c1, uint8_t c2, uint8_t c3) {
+    _match3<Printable> m = {c1, c2, c3};
+    return _bytepos<Exists, Reverse>(m.m8(cast<uint64_t>(s)));
 }
 
-// Find zero byte in printable string
-inline uint32_t pstrlen(const char* s) {
-    // check words for zero
-    const char* p = s;
-    while (!haszero(cast<uint64_t>(p))) {
-        p += 8;
-    }
+// Find any char of a set in a string of 8 chars. Support all options.
+template<bool Printable, bool Exists, bool Reverse>
+inline uint32_t _memchr8(const char* s, const byteset& set) {
+    _matchset<Printable> m = {set};
+    return _bytepos<Exists, Reverse>(m.m8(cast<uint64_t>(s)));
+}
 
-    return p - s + pmemchr8k(p, 8);
+// Find any of 2 chars in const string. Support all options
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _memchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    _match2<Printable> m = {c1, c2};
+    return Reverse ? _rscanv<Known>(s, len, m) : _scanv<Known>(s, len, m);
 }
 
-// Get the uint _cast_ of a string of up to 8 chars
-inline uint64_t cast8(const char* s, uint32_t len) {
-    assert(len <= 8);
+// Find any of 3 chars in const string. Support all options
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _memchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    _match3<Printable> m = {c1, c2, c3};
+    return Reverse ? _rscanv<Known>(s, len, m) : _scanv<Known>(s, len, m);
+}
 
-    // int 64 of s
-    uint64_t x = cast<uint64_t>(s);
+// Find any char of a set in const string. Support all options
+template<bool Printable, bool Known, bool Reverse>
+inline uint32_t _memchrset(const char* s, uint32_t len, const byteset& set) {
+    _matchset<Printable> m = {set};
+    return Reverse ? _rscanv<Known>(s, len, m) : _scanv<Known>(s, len, m);
+}
 
-    uint64_t mask = (1ull << (len * 8)) - 1;
-    mask |= -(len == 8); // fill 1's if len == 8
+// Find any of 2 chars in binary string
+inline uint32_t memchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<false, false, false>(s, len, c1, c2);
+}
 
-    return x & mask;
+// Find any of 2 chars in binary string. One is known to be in s + len
+inline uint32_t memchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<false, true, false>(s, len, c1, c2);
 }
 
-//// string to int
+// Find any of 2 chars in printable string
+inline uint32_t pmemchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<true, false, false>(s, len, c1, c2);
+}
 
-// Parse uint from string of up to 4 chars
-inline uint16_t atou4(const char* s, uint32_t len) {
-    assert(len <= 4);
+// Find any of 2 chars in printable string. One is known to be in s + len
+inline uint32_t pmemchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<true, true, false>(s, len, c1, c2);
+}
 
-    // int 64 of s. "1234" --> 0x34333231
-    uint32_t x = cast<uint32_t>(s);
+// Find last of any of 2 chars in binary string
+inline uint32_t memrchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<false, false, true>(s, len, c1, c2);
+}
 
-    // apply len. len of 2 --> 0x32310000
-    x <<= 32 - len * 8;
-    x &= -(uint32_t)(len > 0);
+// Find last of any of 2 chars in binary string. One is known to be in s + len
+inline uint32_t memrchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<false, true, true>(s, len, c1, c2);
+}
 
-    // add ones and tens, in int8's, from 0x0[2]0[1] to 0x00[12]
-    x = (x & 0x0f0f0f0fu) * ((1u << 8) * 10 + 1) >> 8;
+// Find last of any of 2 chars in printable string
+inline uint32_t pmemrchr2(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<true, false, true>(s, len, c1, c2);
+}
 
-    // add int16's, from 0x00[34]00[12] to 0x0000[1234]
-    x = (x & 0x00ff00ffu) * ((1u << 16) * 100 + 1) >> 16;
+// Find last of any of 2 chars in printable string. One is known to be in s + len
+inline uint32_t pmemrchr2k(const char* s, uint32_t len, uint8_t c1, uint8_t c2) {
+    return _memchr2<true, true, true>(s, len, c1, c2);
+}
 
-    return x;
+// Find any of 3 chars in binary string
+inline uint32_t memchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<false, false, false>(s, len, c1, c2, c3);
 }
 
-// Parse uint from string of up to 8 chars
-inline uint32_t atou8(const char* s, uint32_t len) {
-    assert(len <= 8);
+// Find any of 3 chars in binary string. One is known to be in s + len
+inline uint32_t memchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<false, true, false>(s, len, c1, c2, c3);
+}
 
-    // int 64 of s. "12345678" --> 0x3837363534333231
-    uint64_t x = cast<uint64_t>(s);
+// Find any of 3 chars in printable string
+inline uint32_t pmemchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<true, false, false>(s, len, c1, c2, c3);
+}
 
-    // apply len. len of 2 --> 0x3231000000000000
-    x <<= 64 - len * 8;
-    x &= -(uint64_t)(len > 0);
+// Find any of 3 chars in printable string. One is known to be in s + len
+inline uint32_t pmemchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<true, true, false>(s, len, c1, c2, c3);
+}
 
-    // add ones and tens, in int8's, from 0x0[2]0[1] to 0x00[12]
-    x = (x & 0x0f0f0f0f0f0f0f0full) * ((1ull << 8) * 10 + 1) >> 8;
+// Find last of any of 3 chars in binary string
+inline uint32_t memrchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<false, false, true>(s, len, c1, c2, c3);
+}
 
-    // add int16's, from 0x00[34]00[12] to 0x0000[1234]
-    x = (x & 0x00ff00ff00ff00ffull) * ((1ull << 16) * 100 + 1) >> 16;
+// Find last of any of 3 chars in binary string. One is known to be in s + len
+inline uint32_t memrchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<false, true, true>(s, len, c1, c2, c3);
+}
 
-    // add int32's, from 0x0000[1234]0000[5678] to 0x[12345678]
-    x = (x & 0x0000ffff0000ffffull) * ((1ull << 32) * 10000 + 1) >> 32;
+// Find last of any of 3 chars in printable string
+inline uint32_t pmemrchr3(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<true, false, true>(s, len, c1, c2, c3);
+}
 
-    return x;
+// Find last of any of 3 chars in printable string. One is known to be in s + len
+inline uint32_t pmemrchr3k(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint8_t c3) {
+    return _memchr3<true, true, true>(s, len, c1, c2, c3);
 }
 
-// Parse uint64_t from string of up to 20 chars
+// Find any char of a set in binary string
+inline uint32_t memchrset(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<false, false, false>(s, len, set);
+}
+
+// Find any char of a set in binary string. One is known to be in s + len
+inline uint32_t memchrsetk(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<false, true, false>(s, len, set);
+}
+
+// Find any char of a set in printable string
+inline uint32_t pmemchrset(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<true, false, false>(s, len, set);
+}
+
+// Find any char of a set in printable string. One is known to be in s + len
+inline uint32_t pmemchrsetk(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<true, true, false>(s, len, set);
+}
+
+// Find last of any char of a set in binary string
+inline uint32_t memrchrset(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<false, false, true>(s, len, set);
+}
+
+// Find last of any char of a set in binary string. One is known to be in s + len
+inline uint32_t memrchrsetk(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<false, true, true>(s, len, set);
+}
+
+// Find last of any char of a set in printable string
+inline uint32_t pmemrchrset(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<true, false, true>(s, len, set);
+}
+
+// Find last of any char of a set in printable string. One is known to be in s + len
+inline uint32_t pmemrchrsetk(const char* s, uint32_t len, const byteset& set) {
+    return _memchrset<true, true, true>(s, len, set);
+}
+
+//// Find substring
+
+inline _needle::_needle(const char* s, uint32_t len) : s(s), len(len), w0(0), w1(0) {
+    assert(len >= 2);
+    first = extend<uint64_t>(s[0]);
+    last = extend<uint64_t>(s[len - 1]);
+
+    // No read past the needle, that may be a literal. A byte at a time,
+    // as memcpy of a variable length is a call
+    for (uint32_t i = 0; i < len && i < 16; i++) {
+        uint64_t& w = i < 8 ? w0 : w1;
+        w |= uint64_t((uint8_t)s[i]) << (i % 8 * 8);
+    }
+}
+
+template<bool Printable>
+inline uint64_t _needle::ends8(const char* p) const {
+    return _zerobytes<Printable>(cast<uint64_t>(p) ^ first) &
+           _zerobytes<Printable>(cast<uint64_t>(p + len - 1) ^ last);
+}
+
+inline bool _needle::at(const char* p) const {
+    // The first word, then the second, then the rest. p + len is in the
+    // string, so the words read at most 7 bytes past it
+    uint64_t x = (cast<uint64_t>(p) ^ w0) & _bytesmask(len < 8 ? len : 8);
+    if (len <= 8)
+        return !x;
+    x |= (cast<uint64_t>(p + 8) ^ w1) & _bytesmask(len < 16 ? len - 8 : 8);
+    if (len <= 16 || x)
+        return !x;
+    return ::memcmp(p + 16, s + 16, len - 16) == 0;
+}
+
+// Find needle in the positions from, to m, of s, word at a time
+template<bool Printable>
+inline uint32_t _memmem_scan(const char* s, uint32_t from, uint32_t m, const _needle& n) {
+    for (uint32_t i = from; i < m; i += 8) {
+        // Drop candidates past m, in the last word
+        uint64_t bits = n.ends8<Printable>(s + i) & _bytesmask(m - i < 8 ? m - i : 8);
+        for (; bits; bits &= bits - 1) {
+            uint32_t j = i + _bytepos<true, false>(bits);
+            if (n.at(s + j))
+                return j;
+        }
+    }
+    return -1;
+}
+
+// Find last needle in the positions before m, of s, word at a time
+template<bool Printable>
+inline uint32_t _memmem_rscan(const char* s, uint32_t m, const _needle& n) {
+    // Whole words from the end, then the first, partial, word, from s
+    for (uint32_t i = m; i > 0;) {
+        uint32_t k = i < 8 ? i : 8;
+        i -= k;
+        uint64_t bits = n.ends8<Printable>(s + i) & _bytesmask(k);
+        while (bits) {
+            uint32_t b = _bytepos<true, true>(bits);
+            if (n.at(s + i + b))
+                return i + b;
+            bits ^= 0x80ull << (b * 8);
+        }
+    }
+    return -1;
+}
+
+#if SWAR_X86
+
+// Find needle in the first m positions of s, 16 positions at a time.
+// Loads are unaligned, so only blocks within the string use them, and the
+// SWAR scan does the rest
+template<bool Printable>
+TARGET("sse2")
+inline uint32_t _memmem_vscan16(const char* s, uint32_t m, const _needle& n) {
+    __m128i f = _mm_set1_epi8((char)n.first);
+    __m128i l = _mm_set1_epi8((char)n.last);
+    uint32_t i = 0;
+    for (; i + 16 <= m; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(s + i + n.len - 1));
+        uint32_t bits = _mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(x, f), _mm_cmpeq_epi8(y, l)));
+        for (; bits; bits &= bits - 1) {
+            uint32_t j = i + __builtin_ctz(bits);
+            if (n.at(s + j))
+                return j;
+        }
+    }
+    return _memmem_scan<Printable>(s, i, m, n);
+}
+
+// Find needle in the first m positions of s, 32 positions at a time
+template<bool Printable>
+TARGET("avx2")
+inline uint32_t _memmem_vscan32(const char* s, uint32_t m, const _needle& n) {
+    __m256i f = _mm256_set1_epi8((char)n.first);
+    __m256i l = _mm256_set1_epi8((char)n.last);
+    uint32_t i = 0;
+    for (; i + 32 <= m; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(s + i + n.len - 1));
+        uint32_t bits = _mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(x, f), _mm256_cmpeq_epi8(y, l)));
+        for (; bits; bits &= bits - 1) {
+            uint32_t j = i + __builtin_ctz(bits);
+            if (n.at(s + j))
+                return j;
+        }
+    }
+    return _memmem_scan<Printable>(s, i, m, n);
+}
+
+// Find last needle in the first m positions of s, 16 positions at a time.
+// Blocks from the end, then the SWAR scan of the positions before them
+template<bool Printable>
+TARGET("sse2")
+inline uint32_t _memmem_vrscan16(const char* s, uint32_t m, const _needle& n) {
+    __m128i f = _mm_set1_epi8((char)n.first);
+    __m128i l = _mm_set1_epi8((char)n.last);
+    uint32_t i = m;
+    for (; i >= 16;) {
+        i -= 16;
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(s + i + n.len - 1));
+        uint32_t bits = _mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(x, f), _mm_cmpeq_epi8(y, l)));
+        while (bits) {
+            uint32_t b = 31 - __builtin_clz(bits);
+            if (n.at(s + i + b))
+                return i + b;
+            bits ^= 1u << b;
+        }
+    }
+    return _memmem_rscan<Printable>(s, i, n);
+}
+
+// Find last needle in the first m positions of s, 32 positions at a time
+template<bool Printable>
+TARGET("avx2")
+inline uint32_t _memmem_vrscan32(const char* s, uint32_t m, const _needle& n) {
+    __m256i f = _mm256_set1_epi8((char)n.first);
+    __m256i l = _mm256_set1_epi8((char)n.last);
+    uint32_t i = m;
+    for (; i >= 32;) {
+        i -= 32;
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(s + i + n.len - 1));
+        uint32_t bits = _mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(x, f), _mm256_cmpeq_epi8(y, l)));
+        while (bits) {
+            uint32_t b = 31 - __builtin_clz(bits);
+            if (n.at(s + i + b))
+                return i + b;
+            bits ^= 1u << b;
+        }
+    }
+    return _memmem_rscan<Printable>(s, i, n);
+}
+
+#endif // SWAR_X86
+
+// Find needle, or last needle, in const string. Widest path the cpu has
+template<bool Printable, bool Reverse>
+inline uint32_t _memmem(const char* s, uint32_t len, const char* needle, uint32_t nlen) {
+    // A single char is memchr
+    if (nlen <= 1) {
+        if (nlen == 0)
+            return Reverse ? len : 0;
+        return Reverse ? _memrchrv<Printable, false>(s, len, needle[0])
+                       : _memchrv<Printable, false>(s, len, needle[0]);
+    }
+    if (nlen > len)
+        return -1;
+
+    // Positions where the needle may start
+    uint32_t m = len - nlen + 1;
+    _needle n(needle, nlen);
+#if SWAR_X86
+    // Up to 2 words are faster with SWAR
+    if (m > 16) {
+        if (_vecwidth == 32)
+            return Reverse ? _memmem_vrscan32<Printable>(s, m, n)
+                           : _memmem_vscan32<Printable>(s, m, n);
+        if (_vecwidth == 16)
+            return Reverse ? _memmem_vrscan16<Printable>(s, m, n)
+                           : _memmem_vscan16<Printable>(s, m, n);
+    }
+#endif
+    return Reverse ? _memmem_rscan<Printable>(s, m, n) : _memmem_scan<Printable>(s, 0, m, n);
+}
+
+// Find needle in binary string. An empty needle is at 0
+inline uint32_t memmem(const char* s, uint32_t len, const char* needle, uint32_t nlen) {
+    return _memmem<false, false>(s, len, needle, nlen);
+}
+
+// Find needle in printable string. An empty needle is at 0
+inline uint32_t pmemmem(const char* s, uint32_t len, const char* needle, uint32_t nlen) {
+    return _memmem<true, false>(s, len, needle, nlen);
+}
+
+// Find last needle in binary string. An empty needle is at len
+inline uint32_t memrmem(const char* s, uint32_t len, const char* needle, uint32_t nlen) {
+    return _memmem<false, true>(s, len, needle, nlen);
+}
+
+// Find last needle in printable string. An empty needle is at len
+inline uint32_t pmemrmem(const char* s, uint32_t len, const char* needle, uint32_t nlen) {
+    return _memmem<true, true>(s, len, needle, nlen);
+}
+
+//// Bitmaps of char positions
+
+// Gather the high bits of the 8 bytes into the low 8 bits.
+// x has only high bits set, like _zerobytes returns
+inline uint32_t _highbits(uint64_t x) {
+    // Bit 8k + 7 moves to 56 + k. No two other partial products hit the same bit
+    return (x * 0x0002040810204081ull) >> 56;
+}
+
+// Bitmaps of c1 and c2 in 64 bytes. Bit i is set if s[i] is c
+template<bool Printable>
+inline void _bitmap64(const char* s, uint8_t c1, uint8_t c2, uint64_t& b1, uint64_t& b2) {
+    uint64_t m1 = extend<uint64_t>(c1);
+    uint64_t m2 = extend<uint64_t>(c2);
+    b1 = 0;
+    b2 = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t x = cast<uint64_t>(s + i * 8);
+        b1 |= (uint64_t)_highbits(_zerobytes<Printable>(x ^ m1)) << (i * 8);
+        b2 |= (uint64_t)_highbits(_zerobytes<Printable>(x ^ m2)) << (i * 8);
+    }
+}
+
+#if SWAR_X86
+// Bitmaps of c1 and c2 in 64 bytes, with AVX2
+TARGET("avx2")
+inline void _bitmap64avx2(const char* s, uint8_t c1, uint8_t c2, uint64_t& b1, uint64_t& b2) {
+    __m256i lo = _mm256_loadu_si256((const __m256i*)s);
+    __m256i hi = _mm256_loadu_si256((const __m256i*)(s + 32));
+    __m256i m1 = _mm256_set1_epi8(c1);
+    __m256i m2 = _mm256_set1_epi8(c2);
+    b1 = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, m1)) |
+         (uint64_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, m1)) << 32;
+    b2 = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, m2)) |
+         (uint64_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, m2)) << 32;
+}
+#endif
+
+// Bitmaps of c1 and c2 in up to 64 bytes. Widest path the cpu has.
+// Bits past len are clear. Never reads past len, unless Padded
+template<bool Printable, bool Padded>
+inline void _bitmap64v(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t& b1, uint64_t& b2) {
+    // Copy the last block, so the loads stay in the string.
+    // Bits of the padding get masked away
+    char tmp[64];
+    if (!Padded && len < 64) {
+        memset(tmp, 0, sizeof(tmp));
+        memcpy(tmp, s, len);
+        s = tmp;
+    }
+
+#if SWAR_X86
+    if (_vecwidth == 32) {
+        _bitmap64avx2(s, c1, c2, b1, b2);
+    }
+    else
+#endif
+    {
+        _bitmap64<Printable>(s, c1, c2, b1, b2);
+    }
+
+    uint64_t mask = len < 64 ? (1ull << len) - 1 : ~0ull;
+    b1 &= mask;
+    b2 &= mask;
+}
+
+// Bitmaps of c1 and c2 in a string. Support all options
+template<bool Printable>
+inline void _bitindex(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t* b1, uint64_t* b2) {
+    for (uint32_t i = 0; i < len; i += 64) {
+        _bitmap64v<Printable>(s + i, len - i, c1, c2, *b1++, *b2++);
+    }
+}
+
+// Bitmaps of c1 and c2 in a binary string
+inline void bitindex(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t* b1, uint64_t* b2) {
+    _bitindex<false>(s, len, c1, c2, b1, b2);
+}
+
+// Bitmaps of c1 and c2 in a printable string
+inline void pbitindex(const char* s, uint32_t len, uint8_t c1, uint8_t c2, uint64_t* b1, uint64_t* b2) {
+    _bitindex<true>(s, len, c1, c2, b1, b2);
+}
+
+// Find char in NON-CONST string
+template<bool Printable>
+inline uint32_t _memchr_nc(char* s, uint32_t len, uint8_t c) {
+    const char* p = s;
+
+    // Replace back with sentinel so we don't have to check for length
+    uint8_t back = s[len - 1];
+    s[len - 1] = c;
+
+    // Check words for that byte.
+    while (!hasbyte(cast<uint64_t>(p), c)) {
+        p += 8;
+    }
+
+    // Find the position
+    p += _memchr8<Printable, true>(p, c);
+
+    // restore sentinel
+    s[len - 1] = back;
+
+    uint32_t ret = p - s;
+    return (ret != len - 1 || back == c) ? ret : -1;
+}
+
+// Find char in binary NON-CONST string
+inline uint32_t memchr_nc(char* s, uint32_t len, uint8_t c) {
+    return _memchr_nc<false>(s, len, c);
+}
+
+// Find char in printable NON-CONST string
+inline uint32_t pmemchr_nc(char* s, uint32_t len, uint8_t c) {
+    return _memchr_nc<true>(s, len, c);
+}
+
+//// Padded strings
+
+inline padded_buffer::padded_buffer(uint32_t capacity)
+    : buf((char*)malloc(capacity + padding)), len(0), cap(capacity) {
+    assert(buf);
+    memset(buf + cap, 0, padding);
+}
+
+inline padded_buffer::~padded_buffer() {
+    free(buf);
+}
+
+inline void padded_buffer::resize(uint32_t n) {
+    assert(n <= cap);
+    len = n;
+}
+
+inline void padded_buffer::assign(const char* s, uint32_t n) {
+    assert(n <= cap);
+    memcpy(buf, s, n);
+    len = n;
+}
+
+#if SWAR_X86
+// Find char in padded string, 16 bytes at a time, from s.
+// No alignment, and no masking of the first or last block
+TARGET("sse2")
+inline uint32_t _memchr_pad16(padded_view s, uint8_t c) {
+    __m128i m = _mm_set1_epi8(c);
+    for (uint32_t i = 0; i < s.len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s.data + i));
+        uint32_t bits = _mm_movemask_epi8(_mm_cmpeq_epi8(x, m));
+        if (bits) {
+            uint32_t pos = i + __builtin_ctz(bits);
+            return pos < s.len ? pos : -1;
+        }
+    }
+    return -1;
+}
+
+// Find char in padded string, 32 bytes at a time, from s
+TARGET("avx2")
+inline uint32_t _memchr_pad32(padded_view s, uint8_t c) {
+    __m256i m = _mm256_set1_epi8(c);
+    for (uint32_t i = 0; i < s.len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s.data + i));
+        uint32_t bits = _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, m));
+        if (bits) {
+            uint32_t pos = i + __builtin_ctz(bits);
+            return pos < s.len ? pos : -1;
+        }
+    }
+    return -1;
+}
+#endif
+
+// Find char in padded string. Support all options
+template<bool Printable>
+inline uint32_t _memchr_pad(padded_view s, uint8_t c) {
+#if SWAR_X86
+    // Up to 2 words are faster with SWAR
+    if (s.len > 16) {
+        if (_vecwidth == 32)
+            return _memchr_pad32(s, c);
+        if (_vecwidth == 16)
+            return _memchr_pad16(s, c);
+    }
+#endif
+
+    // Whole words. A match in the padding is past len. Bytes of the
+    // padding that are not printable only carry to the bytes above them
+    uint64_t m = extend<uint64_t>(c);
+    for (uint32_t i = 0; i < s.len; i += 8) {
+        uint64_t bits = _zerobytes<Printable>(cast<uint64_t>(s.data + i) ^ m);
+        if (bits) {
+            uint32_t pos = i + _bytepos<true, false>(bits);
+            return pos < s.len ? pos : -1;
+        }
+    }
+    return -1;
+}
+
+// Find char in binary padded string
+inline uint32_t memchr(padded_view s, uint8_t c) {
+    return _memchr_pad<false>(s, c);
+}
+
+// Find char in printable padded string
+inline uint32_t pmemchr(padded_view s, uint8_t c) {
+    return _memchr_pad<true>(s, c);
+}
+
+// Find zero byte in binary padded string, or len if there is none.
+// Like strnlen
+inline uint32_t strlen(padded_view s) {
+    uint32_t pos = _memchr_pad<false>(s, 0);
+    return pos < s.len ? pos : s.len;
+}
+
+// Find zero byte in printable padded string, or len if there is none
+inline uint32_t pstrlen(padded_view s) {
+    uint32_t pos = _memchr_pad<true>(s, 0);
+    return pos < s.len ? pos : s.len;
+}
+
+// Parse uint64_t from padded string of up to 20 chars.
+// The word reads past len stay in the padding
+inline uint64_t atou(padded_view s) {
+    return atou(s.data, s.len);
+}
+
+// Parse _signed_ int from padded string of up to 20 chars. No spaces
+inline int64_t atoi(padded_view s) {
+    return atoi(s.data, s.len);
+}
+
+//// ASCII case
+
+// Convert word x to lower case
+inline uint64_t _tolower8w(uint64_t x) {
+    // The high bit of A-Z, shifted to 0x20
+    return x | (_bytesbetween(x, 'A', 'Z') >> 2);
+}
+
+// Convert word x to upper case
+inline uint64_t _toupper8w(uint64_t x) {
+    return x & ~(_bytesbetween(x, 'a', 'z') >> 2);
+}
+
+// Convert 8 chars to lower case, from s to d. s and d may be the same
+inline void tolower8(const char* s, char* d) {
+    uint64_t x = _tolower8w(cast<uint64_t>(s));
+    memcpy(d, &x, 8);
+}
+
+// Convert 8 chars to upper case, from s to d. s and d may be the same
+inline void toupper8(const char* s, char* d) {
+    uint64_t x = _toupper8w(cast<uint64_t>(s));
+    memcpy(d, &x, 8);
+}
+
+// Convert string to lower or upper case, from s to d, a word at a time.
+// s and d may be the same, and must not overlap otherwise
+template<bool Upper>
+inline void _tocase(const char* s, uint32_t len, char* d) {
+    auto conv = [](uint64_t x) { return Upper ? _toupper8w(x) : _tolower8w(x); };
+
+    // Short string. Read a word, write len bytes
+    if (len < 8) {
+        uint64_t x = conv(cast<uint64_t>(s));
+        memcpy(d, &x, len);
+        return;
+    }
+
+    // Whole words, then the last 8 bytes again. Converting twice is the
+    // same as once, so the overlap needs no mask.
+    // Load the last word first, in case d is s
+    uint64_t last = conv(cast<uint64_t>(s + len - 8));
+    for (uint32_t i = 0; i + 8 <= len; i += 8) {
+        uint64_t x = conv(cast<uint64_t>(s + i));
+        memcpy(d + i, &x, 8);
+    }
+    memcpy(d + len - 8, &last, 8);
+}
+
+// Convert string to lower case, from s to d. s and d may be the same.
+// Writes exactly len bytes
+inline void tolower(const char* s, uint32_t len, char* d) {
+    _tocase<false>(s, len, d);
+}
+
+// Convert string to upper case, from s to d. s and d may be the same.
+// Writes exactly len bytes
+inline void toupper(const char* s, uint32_t len, char* d) {
+    _tocase<true>(s, len, d);
+}
+
+// Are the first len <= 8 chars of a and b equal, ignoring case?
+inline bool eq8_ci(const char* a, const char* b, uint32_t len) {
+    uint64_t x = _tolower8w(cast<uint64_t>(a)) ^ _tolower8w(cast<uint64_t>(b));
+    return !(x & _bytesmask(len));
+}
+
+// Are len chars of a and b equal, ignoring case?
+inline bool eq_ci(const char* a, const char* b, uint32_t len) {
+    // Whole words, then the last, partial, one
+    uint32_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        if (_tolower8w(cast<uint64_t>(a + i)) != _tolower8w(cast<uint64_t>(b + i)))
+            return false;
+    }
+    return eq8_ci(a + i, b + i, len - i);
+}
+
+// Find char, in either case, in binary string.
+// Any of the lower and upper case chars, that are the same if c is not
+// a letter
+inline uint32_t memchr_ci(const char* s, uint32_t len, uint8_t c) {
+    uint8_t lo = _tolower8w(c);
+    uint8_t up = _toupper8w(c);
+    return _scanv<false>(s, len, _match2<false>{lo, up});
+}
+
+// Find char, in either case, in printable string
+inline uint32_t pmemchr_ci(const char* s, uint32_t len, uint8_t c) {
+    uint8_t lo = _tolower8w(c);
+    uint8_t up = _toupper8w(c);
+    return _scanv<false>(s, len, _match2<true>{lo, up});
+}
+
+// Find zero byte in binary string up to 8 chars
+constexpr uint32_t strlen8(const char* s) {
+    return memchr8(s, 0);
+}
+
+// Find zero byte in printable string up to 8 chars
+constexpr uint32_t pstrlen8(const char* s) {
+    return pmemchr8(s, 0);
+}
+
+// Find zero byte in string. Support all options
+template<bool Printable, bool Aligned>
+inline uint32_t _strlen(const char* s) {
+    // Aligned reads from the word s is in. The bytes before s are set to 1
+    uint32_t off = Aligned ? (uintptr_t)s & 7 : 0;
+    const char* p = s - off;
+    uint64_t mask = _bytesmask(off);
+    uint64_t x = (cast<uint64_t>(p) & ~mask) | (mask & 0x0101010101010101ull);
+
+    // check words for zero
+    while (!haszero(x)) {
+        p += 8;
+        x = cast<uint64_t>(p);
+    }
+
+    return (p - s) + _bytepos<true, false>(_zerobytes<Printable>(x));
+}
+
+// Find zero byte in binary string
+template<bool Aligned>
+inline uint32_t strlen(const char* s) {
+    return _strlen<false, Aligned>(s);
+}
+
+// Find zero byte in printable string
+template<bool Aligned>
+inline uint32_t pstrlen(const char* s) {
+    return _strlen<true, Aligned>(s);
+}
+
+// Get the uint _cast_ of a string of up to 8 chars
+constexpr uint64_t cast8(const char* s, uint32_t len) {
+    assert(len <= 8);
+
+    // Only len chars at compile time, not past the end of a literal
+    if (SWAR_IS_CONSTANT_EVALUATED()) {
+        uint64_t x = 0;
+        for (uint32_t i = 0; i < len; i++)
+            x |= (uint64_t)(uint8_t)s[i] << (i * 8);
+        return x;
+    }
+
+    // int 64 of s
+    uint64_t x = cast<uint64_t>(s);
+
+    // len of 8 shifts by 0, as shifting by 64 is undefined
+    uint64_t mask = (1ull << ((len * 8) & 63)) - 1;
+    mask |= -(len == 8); // fill 1's if len == 8
+
+    return x & mask;
+}
+
+//// Short string compare
+
+// Compare 2 words as strings, byte 0 first: -1, 0 or 1.
+// Byte swapped, byte 0 is the most significant, so lexicographic order is
+// integer order
+inline int _cmp8w(uint64_t x, uint64_t y) {
+    x = bswap(x);
+    y = bswap(y);
+    return (x > y) - (x < y);
+}
+
+// Are the first len <= 8 chars of a and b equal?
+inline bool eq8(const char* a, const char* b, uint32_t len) {
+    assert(len <= 8);
+    uint64_t x = cast<uint64_t>(a) ^ cast<uint64_t>(b);
+    return !(x & _bytesmask(len));
+}
+
+// Are the first len <= 16 chars of a and b equal?
+inline bool eq16(const char* a, const char* b, uint32_t len) {
+    assert(len <= 16);
+    uint32_t n = len < 8 ? len : 8;
+    // The second word from a + 8 only if there is one, so no read is more
+    // than 7 bytes past the end. Otherwise it is masked out
+    uint32_t k = len > 8 ? 8 : 0;
+    uint64_t x0 = cast<uint64_t>(a) ^ cast<uint64_t>(b);
+    uint64_t x1 = cast<uint64_t>(a + k) ^ cast<uint64_t>(b + k);
+    return !((x0 & _bytesmask(n)) | (x1 & _bytesmask(len - n)));
+}
+
+// Compare strings of up to 8 chars, like memcmp and then the lengths.
+// Negative, 0 or positive. Branchless
+inline int cmp8(const char* a, uint32_t alen, const char* b, uint32_t blen) {
+    // Zero padded words. A tie, like "AB" vs "AB\0", is a prefix, so the
+    // shorter is less. The word compare outweighs the lengths
+    int c = _cmp8w(cast8(a, alen), cast8(b, blen));
+    return 2 * c + (alen > blen) - (alen < blen);
+}
+
+// Compare strings of up to 16 chars, like memcmp and then the lengths.
+// Negative, 0 or positive. Branchless
+inline int cmp16(const char* a, uint32_t alen, const char* b, uint32_t blen) {
+    assert(alen <= 16 && blen <= 16);
+    uint32_t an = alen < 8 ? alen : 8;
+    uint32_t bn = blen < 8 ? blen : 8;
+    // Both words of both strings, even if shorter than 8. A zero length
+    // word is 0, and is read from the first word, so no read is more than
+    // 7 bytes past the end
+    int c0 = _cmp8w(cast8(a, an), cast8(b, bn));
+    int c1 = _cmp8w(cast8(a + (alen > 8) * 8, alen - an),
+                    cast8(b + (blen > 8) * 8, blen - bn));
+    return 4 * c0 + 2 * c1 + (alen > blen) - (alen < blen);
+}
+
+//// string to int
+
+// Parse uint from string of up to 4 chars
+constexpr uint16_t atou4(const char* s, uint32_t len) {
+    assert(len <= 4);
+
+    // int 64 of s. "1234" --> 0x34333231.
+    // Only len chars at compile time
+    uint32_t x = SWAR_IS_CONSTANT_EVALUATED() ? cast8(s, len) : cast<uint32_t>(s);
+
+    // apply len. len of 2 --> 0x32310000
+    // len of 0 shifts by 0, and is masked out, as shifting by 32 is undefined
+    x <<= (32 - len * 8) & 31;
+    x &= -(uint32_t)(len > 0);
+
+    // add ones and tens, in int8's, from 0x0[2]0[1] to 0x00[12]
+    x = (x & 0x0f0f0f0fu) * ((1u << 8) * 10 + 1) >> 8;
+
+    // add int16's, from 0x00[34]00[12] to 0x0000[1234]
+    x = (x & 0x00ff00ffu) * ((1u << 16) * 100 + 1) >> 16;
+
+    return x;
+}
+
+// Parse uint from string of up to 8 chars
+constexpr uint32_t atou8(const char* s, uint32_t len) {
+    assert(len <= 8);
+
+    // int 64 of s. "12345678" --> 0x3837363534333231.
+    // Only len chars at compile time
+    uint64_t x = SWAR_IS_CONSTANT_EVALUATED() ? cast8(s, len) : cast<uint64_t>(s);
+    return _atou8w(x, len);
+}
+
+// Parse uint from the first len chars in word x
+constexpr uint32_t _atou8w(uint64_t x, uint32_t len) {
+    // apply len. len of 2 --> 0x3231000000000000
+    // len of 0 shifts by 0, and is masked out, as shifting by 64 is undefined
+    x <<= (64 - len * 8) & 63;
+    x &= -(uint64_t)(len > 0);
+
+    // add ones and tens, in int8's, from 0x0[2]0[1] to 0x00[12]
+    x = (x & 0x0f0f0f0f0f0f0f0full) * ((1ull << 8) * 10 + 1) >> 8;
+
+    // add int16's, from 0x00[34]00[12] to 0x0000[1234]
+    x = (x & 0x00ff00ff00ff00ffull) * ((1ull << 16) * 100 + 1) >> 16;
+
+    // add int32's, from 0x0000[1234]0000[5678] to 0x[12345678]
+    x = (x & 0x0000ffff0000ffffull) * ((1ull << 32) * 10000 + 1) >> 32;
+
+    return x;
+}
+
+// Parse uint64_t from string of up to 20 chars
 // *** More than 20 char returns junk.
-inline uint64_t atou(const char* s, uint32_t len) {
+constexpr uint64_t atou(const char* s, uint32_t len) {
     assert(len <= 20);
     uint64_t x = 0;
     if (len > 8) {
@@ -434,7 +1713,7 @@ inline uint64_t atou(const char* s, uint32_t len) {
 }
 
 // Parse _signed_ int from string of up to 20 chars. No spaces
-inline int64_t atoi(const char* s, uint32_t len) {
+constexpr int64_t atoi(const char* s, uint32_t len) {
     bool neg = !!len & (*s == '-');
     bool ls = !!len & (*s == '-' || *s == '+');
     s += ls;
@@ -444,79 +1723,546 @@ inline int64_t atoi(const char* s, uint32_t len) {
     return neg ? -x : x;
 }
 
+// Parse uint of up to 16 chars, as 2 blocks of 8
+constexpr uint64_t _atou16(const char* s, uint32_t len) {
+    assert(len <= 16);
+    uint32_t lh = len > 8 ? len - 8 : 0;
+    return atou8(s, lh) * 100000000ull + atou8(s + lh, len - lh);
+}
+
+// Parse unsigned __int128 from string of up to 39 chars.
+// The last 16 digits, the 16 before them, and the first up to 7, combined
+// with 2 multiplies by 10^16
+constexpr unsigned __int128 atou128(const char* s, uint32_t len) {
+    assert(len <= 39);
+    uint32_t ll = len < 16 ? len : 16;
+    uint32_t ml = len - ll < 16 ? len - ll : 16;
+    uint32_t tl = len - ll - ml;
+
+    uint64_t top = atou8(s, tl);
+    uint64_t mid = _atou16(s + tl, ml);
+    uint64_t low = _atou16(s + tl + ml, ll);
+
+    unsigned __int128 e16 = 10000000000000000ull;
+    return ((unsigned __int128)top * e16 + mid) * e16 + low;
+}
+
+// Parse signed __int128 from string of up to 39 digits, and a sign
+constexpr __int128 atoi128(const char* s, uint32_t len) {
+    bool neg = !!len & (*s == '-');
+    bool ls = !!len & (*s == '-' || *s == '+');
+    s += ls;
+
+    unsigned __int128 x = atou128(s, len - ls);
+
+    return neg ? 0 - x : x;
+}
+
+#if SWAR_X86
+// Parse n uints of len <= 8 chars, 4 at a time, with SSE4.1
+TARGET("sse4.1")
+inline void _atou8_batch16(const char* base, size_t stride, uint32_t len, uint32_t* out, size_t n) {
+    // Same steps as atou8, on 64 bit lanes.
+    // Shift to apply len, then add pairs of digits, pairs of pairs, and
+    // pairs of 4 digits, with multiply-add
+    __m128i shift = _mm_cvtsi32_si128(64 - len * 8);
+    __m128i m0f = _mm_set1_epi8(0x0f);
+    __m128i w10 = _mm_set1_epi16(0x010a);         // bytes 10, 1
+    __m128i w100 = _mm_set1_epi32(0x00010064);    // int16's 100, 1
+    __m128i w10000 = _mm_set1_epi32(0x00012710);  // int16's 10000, 1
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const char* s = base + i * stride;
+        __m128i a = _mm_set_epi64x(cast<uint64_t>(s + stride), cast<uint64_t>(s));
+        __m128i b = _mm_set_epi64x(cast<uint64_t>(s + 3 * stride), cast<uint64_t>(s + 2 * stride));
+
+        a = _mm_and_si128(_mm_sll_epi64(a, shift), m0f);
+        b = _mm_and_si128(_mm_sll_epi64(b, shift), m0f);
+        a = _mm_madd_epi16(_mm_maddubs_epi16(a, w10), w100);
+        b = _mm_madd_epi16(_mm_maddubs_epi16(b, w10), w100);
+
+        // 4 digits fit in int16
+        __m128i x = _mm_madd_epi16(_mm_packus_epi32(a, b), w10000);
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+
+    for (; i < n; i++) {
+        out[i] = atou8(base + i * stride, len);
+    }
+}
+
+// Parse n uints of len <= 8 chars, 8 at a time, with AVX2
+TARGET("avx2")
+inline void _atou8_batch32(const char* base, size_t stride, uint32_t len, uint32_t* out, size_t n) {
+    __m128i shift = _mm_cvtsi32_si128(64 - len * 8);
+    __m256i m0f = _mm256_set1_epi8(0x0f);
+    __m256i w10 = _mm256_set1_epi16(0x010a);
+    __m256i w100 = _mm256_set1_epi32(0x00010064);
+    __m256i w10000 = _mm256_set1_epi32(0x00012710);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const char* s = base + i * stride;
+        __m256i a = _mm256_set_epi64x(
+            cast<uint64_t>(s + 3 * stride), cast<uint64_t>(s + 2 * stride),
+            cast<uint64_t>(s + stride), cast<uint64_t>(s));
+        __m256i b = _mm256_set_epi64x(
+            cast<uint64_t>(s + 7 * stride), cast<uint64_t>(s + 6 * stride),
+            cast<uint64_t>(s + 5 * stride), cast<uint64_t>(s + 4 * stride));
+
+        a = _mm256_and_si256(_mm256_sll_epi64(a, shift), m0f);
+        b = _mm256_and_si256(_mm256_sll_epi64(b, shift), m0f);
+        a = _mm256_madd_epi16(_mm256_maddubs_epi16(a, w10), w100);
+        b = _mm256_madd_epi16(_mm256_maddubs_epi16(b, w10), w100);
+
+        // Pack is per 128 bit lane, so results are 0 1 4 5 2 3 6 7
+        __m256i x = _mm256_madd_epi16(_mm256_packus_epi32(a, b), w10000);
+        x = _mm256_permute4x64_epi64(x, 0xd8);
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+
+    _atou8_batch16(base + i * stride, stride, len, out + i, n - i);
+}
+
+// Fields at the end of a batch of n, where the 16 byte load from the last
+// lv digits would read more than 7 bytes past the end of the last field.
+// These are parsed one at a time
+inline size_t _atou_batch_tail(size_t stride, uint32_t lv, size_t n) {
+    if (lv >= 9)
+        return 0;
+    size_t t = stride ? (9 - lv + stride - 1) / stride : n;
+    return t < n ? t : n;
+}
+
+// Parse n uint64_t's of len <= 20 chars, 2 at a time, with SSE4.1
+TARGET("sse4.1")
+inline void _atou_batch16(const char* base, size_t stride, uint32_t len, uint64_t* out, size_t n) {
+    // Last 16 digits in the vector. The rest, up to 4, with atou4
+    uint32_t lv = len < 16 ? len : 16;
+    uint32_t lh = len - lv;
+
+    // Shuffle to apply len. Negative index gives a zero byte
+    __m128i align = _mm_add_epi8(
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm_set1_epi8(lv - 16));
+    __m128i m0f = _mm_set1_epi8(0x0f);
+    __m128i w10 = _mm_set1_epi16(0x010a);
+    __m128i w100 = _mm_set1_epi32(0x00010064);
+    __m128i w10000 = _mm_set1_epi32(0x00012710);
+    __m128i e8 = _mm_set1_epi32(100000000);
+
+    size_t nv = n - _atou_batch_tail(stride, lv, n);
+    size_t i = 0;
+    for (; i + 2 <= nv; i += 2) {
+        const char* s = base + i * stride + lh;
+        __m128i a = _mm_loadu_si128((const __m128i*)s);
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + stride));
+
+        a = _mm_and_si128(_mm_shuffle_epi8(a, align), m0f);
+        b = _mm_and_si128(_mm_shuffle_epi8(b, align), m0f);
+        a = _mm_madd_epi16(_mm_maddubs_epi16(a, w10), w100);
+        b = _mm_madd_epi16(_mm_maddubs_epi16(b, w10), w100);
+
+        // High and low 8 digits of a, then of b
+        __m128i x = _mm_madd_epi16(_mm_packus_epi32(a, b), w10000);
+
+        // high * 10^8 + low, in 64 bit lanes
+        x = _mm_add_epi64(_mm_mul_epu32(x, e8), _mm_srli_epi64(x, 32));
+        _mm_storeu_si128((__m128i*)(out + i), x);
+    }
+
+    if (lh) {
+        for (size_t j = 0; j < i; j++) {
+            out[j] += atou4(base + j * stride, lh) * 10000000000000000ull;
+        }
+    }
+
+    for (; i < n; i++) {
+        out[i] = atou(base + i * stride, len);
+    }
+}
+
+// Parse n uint64_t's of len <= 20 chars, 4 at a time, with AVX2
+TARGET("avx2")
+inline void _atou_batch32(const char* base, size_t stride, uint32_t len, uint64_t* out, size_t n) {
+    uint32_t lv = len < 16 ? len : 16;
+    uint32_t lh = len - lv;
+
+    __m256i align = _mm256_add_epi8(
+        _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                         0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm256_set1_epi8(lv - 16));
+    __m256i m0f = _mm256_set1_epi8(0x0f);
+    __m256i w10 = _mm256_set1_epi16(0x010a);
+    __m256i w100 = _mm256_set1_epi32(0x00010064);
+    __m256i w10000 = _mm256_set1_epi32(0x00012710);
+    __m256i e8 = _mm256_set1_epi32(100000000);
+
+    size_t nv = n - _atou_batch_tail(stride, lv, n);
+    size_t i = 0;
+    for (; i + 4 <= nv; i += 4) {
+        const char* s = base + i * stride + lh;
+        __m256i a = _mm256_loadu2_m128i(
+            (const __m128i*)(s + stride), (const __m128i*)s);
+        __m256i b = _mm256_loadu2_m128i(
+            (const __m128i*)(s + 3 * stride), (const __m128i*)(s + 2 * stride));
+
+        a = _mm256_and_si256(_mm256_shuffle_epi8(a, align), m0f);
+        b = _mm256_and_si256(_mm256_shuffle_epi8(b, align), m0f);
+        a = _mm256_madd_epi16(_mm256_maddubs_epi16(a, w10), w100);
+        b = _mm256_madd_epi16(_mm256_maddubs_epi16(b, w10), w100);
+
+        // Pack is per 128 bit lane, so results are 0 2 1 3
+        __m256i x = _mm256_madd_epi16(_mm256_packus_epi32(a, b), w10000);
+        x = _mm256_add_epi64(_mm256_mul_epu32(x, e8), _mm256_srli_epi64(x, 32));
+        x = _mm256_permute4x64_epi64(x, 0xd8);
+        _mm256_storeu_si256((__m256i*)(out + i), x);
+    }
+
+    if (lh) {
+        for (size_t j = 0; j < i; j++) {
+            out[j] += atou4(base + j * stride, lh) * 10000000000000000ull;
+        }
+    }
+
+    _atou_batch16(base + i * stride, stride, len, out + i, n - i);
+}
+#endif // SWAR_X86
+
+// Parse n uints of len <= 8 chars, at base, base + stride, etc.
+inline void atou8_batch(const char* base, size_t stride, uint32_t len, uint32_t* out, size_t n) {
+    assert(len <= 8);
+#if SWAR_X86
+    if (_vecwidth == 32) {
+        return _atou8_batch32(base, stride, len, out, n);
+    }
+    if (_sse41) {
+        return _atou8_batch16(base, stride, len, out, n);
+    }
+#endif
+    for (size_t i = 0; i < n; i++) {
+        out[i] = atou8(base + i * stride, len);
+    }
+}
+
+// Parse n uint64_t's of len <= 20 chars, at base, base + stride, etc.
+inline void atou_batch(const char* base, size_t stride, uint32_t len, uint64_t* out, size_t n) {
+    assert(len <= 20);
+#if SWAR_X86
+    if (_vecwidth == 32) {
+        return _atou_batch32(base, stride, len, out, n);
+    }
+    if (_sse41) {
+        return _atou_batch16(base, stride, len, out, n);
+    }
+#endif
+    for (size_t i = 0; i < n; i++) {
+        out[i] = atou(base + i * stride, len);
+    }
+}
+
 // Parse hex int from string of up to 8 chars
-inline uint32_t htou8(const char* s, uint32_t len) {
+constexpr uint32_t htou8(const char* s, uint32_t len) {
     assert(len <= 8);
 
-    // int 64 of s. "12345678" --> 0x3837363534333231
-    uint64_t x = cast<uint64_t>(s);
+    // int 64 of s. "12345678" --> 0x3837363534333231.
+    // Only len chars at compile time
+    uint64_t x = SWAR_IS_CONSTANT_EVALUATED() ? cast8(s, len) : cast<uint64_t>(s);
+    return _htou8w(x, len);
+}
 
+// Parse hex int from the first len chars in word x
+constexpr uint32_t _htou8w(uint64_t x, uint32_t len) {
     // apply len. len of 2 --> 0x3231000000000000
-    x <<= 64 - len * 8;
+    x <<= (64 - len * 8) & 63;
 
     // handle length of 0. remove all bits if zero
     x &= -(uint64_t)(len > 0);
 
-    // change a-f to to number. 0x41 --> 0x0a
-    x += ((x & 0x4040404040404040ull) >> 6) * 9;
+    // change a-f to to number. 0x41 --> 0x0a
+    x += ((x & 0x4040404040404040ull) >> 6) * 9;
+
+    // add ones and 0x10's, in int8's, from 0x0[f]0[1] to 0x00[1f]
+    x = (x & 0x0f0f0f0f0f0f0f0full) * ((1ull << 12) + 1) >> 8;
+
+    // add int16's, from 0x00[ed]00[1f] to 0x0000[1fed]
+    x = (x & 0x00ff00ff00ff00ffull) * ((1ull << 24) + 1) >> 16;
+
+    // add int32's, from 0x0000[1fed]0000[cba9] to 0x[1fedcba9]
+    x = (x & 0x0000ffff0000ffffull) * ((1ull << 48) + 1) >> 32;
+
+    return x;
+}
+
+// Parse hex int from string of up to 16 chars
+constexpr uint64_t htou(const char* s, uint32_t len) {
+    assert(len <= 16);
+    uint64_t x = 0;
+    if (len > 8) {
+        uint32_t lh = len - 8;
+        x = htou8(s, lh);
+        x <<= 32;
+        len -= lh;
+        s += lh;
+    }
+    return x + htou8(s, len);
+}
+
+// Set the high bit in bytes from lo to hi, and clear all other bits.
+// 1 <= lo <= hi < 128
+inline uint64_t _bytesbetween(uint64_t x, uint8_t lo, uint8_t hi) {
+    uint64_t a = 0x7f7f7f7f7f7f7f7full;
+
+    // low 7 bits, so the adds below do not carry to the next byte
+    uint64_t t = x & a;
+
+    // high bit set if t >= lo, and if t > hi
+    uint64_t ge = t + extend<uint64_t>(0x80 - lo);
+    uint64_t gt = t + extend<uint64_t>(0x7f - hi);
+
+    // bytes with the high bit set are out of range
+    return ge & ~gt & ~x & ~a;
+}
+
+// Number of leading decimal digits in word x, up to 8
+inline uint32_t _digits8(uint64_t x) {
+    uint64_t nd = ~_bytesbetween(x, '0', '9') & 0x8080808080808080ull;
+    return nd ? __builtin_ctzll(nd) / 8 : 8;
+}
+
+// Number of leading hex digits in word x, up to 8
+inline uint32_t _hexdigits8(uint64_t x) {
+    // lower case letters. No other byte becomes a-f
+    uint64_t h = _bytesbetween(x, '0', '9') |
+                 _bytesbetween(x | 0x2020202020202020ull, 'a', 'f');
+    uint64_t nd = ~h & 0x8080808080808080ull;
+    return nd ? __builtin_ctzll(nd) / 8 : 8;
+}
+
+// Parse uint64_t from the leading digits of [s, end).
+// Returns the end of the digits, or s, and out unchanged, if there are none
+inline const char* parse_uint(const char* s, const char* end, uint64_t& out) {
+    static const CODE_SECTION uint32_t scales[9] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+    const char* p = s;
+    uint64_t x = 0;
+    bool of = false;
+    for (;;) {
+        // Stop at end, so a multiple of 8 digits does not load a word at it
+        size_t avail = end - p;
+        if (avail == 0)
+            break;
+
+        // One load to count the digits and to parse them
+        uint64_t w = cast<uint64_t>(p);
+        size_t n = _digits8(w);
+        n = n < avail ? n : avail;
+
+        // Only 20 digits or more can overflow
+        if (unlikely(p + n - s > 19)) {
+            of |= __builtin_mul_overflow(x, scales[n], &x);
+            of |= __builtin_add_overflow(x, _atou8w(w, n), &x);
+        }
+        else {
+            x = x * scales[n] + _atou8w(w, n);
+        }
+        p += n;
+        if (n < 8)
+            break;
+    }
+
+    if (p != s)
+        out = of ? ~0ull : x;
+    return p;
+}
+
+// Parse _signed_ int64_t from [s, end). Optional '-' or '+'.
+// Returns the end of the digits, or s, and out unchanged, if there are none
+inline const char* parse_int(const char* s, const char* end, int64_t& out) {
+    bool has = s != end;
+    bool neg = has & (*s == '-');
+    bool ls = has & (*s == '-' || *s == '+');
+
+    uint64_t x;
+    const char* p = parse_uint(s + ls, end, x);
+    if (p == s + ls)
+        return s;
+
+    // Up to 2^63 if negative, 2^63 - 1 if not
+    uint64_t lim = (1ull << 63) - !neg;
+    x = x < lim ? x : lim;
+    out = neg ? -x : x;
+    return p;
+}
 
-    // add ones and 0x10's, in int8's, from 0x0[f]0[1] to 0x00[1f]
-    x = (x & 0x0f0f0f0f0f0f0f0full) * ((1ull << 12) + 1) >> 8;
+// Parse hex uint64_t from the leading hex digits of [s, end).
+// Returns the end of the digits, or s, and out unchanged, if there are none
+inline const char* parse_hex(const char* s, const char* end, uint64_t& out) {
+    const char* p = s;
+    uint64_t x = 0;
+    bool of = false;
+    for (;;) {
+        size_t avail = end - p;
+        if (avail == 0)
+            break;
+
+        uint64_t w = cast<uint64_t>(p);
+        size_t n = _hexdigits8(w);
+        n = n < avail ? n : avail;
+
+        // Shift in 2 steps. n * 4 can be 32, but not 64
+        of |= (x >> (63 - n * 4) >> 1) != 0;
+        x = (x << (n * 2) << (n * 2)) | _htou8w(w, n);
+        p += n;
+        if (n < 8)
+            break;
+    }
 
-    // add int16's, from 0x00[ed]00[1f] to 0x0000[1fed]
-    x = (x & 0x00ff00ff00ff00ffull) * ((1ull << 24) + 1) >> 16;
+    if (p != s)
+        out = of ? ~0ull : x;
+    return p;
+}
 
-    // add int32's, from 0x0000[1fed]0000[cba9] to 0x[1fedcba9]
-    x = (x & 0x0000ffff0000ffffull) * ((1ull << 48) + 1) >> 32;
+//// Checked string to int
+// No separate validation pass. Non-digits are found in the same words the
+// parse loads, and overflow from the top digits
+
+// Parse uint from string of up to 8 chars.
+// Set bits in bad if any is not a digit
+inline uint32_t _atou8c(const char* s, uint32_t len, uint64_t& bad) {
+    // apply len, like _atou8w
+    uint64_t m = -(uint64_t)(len > 0);
+    uint64_t x = (cast<uint64_t>(s) << ((64 - len * 8) & 63)) & m;
+
+    // digits are 0x30 to 0x39: high nibble is 3, and stays 3 after adding 6.
+    // Bytes cut by len are 0, and stay 0. A carry to the next byte only
+    // comes from a byte that is already bad
+    uint64_t h = 0xf0f0f0f0f0f0f0f0ull;
+    uint64_t d = (x & h) | (((x + 0x0606060606060606ull) & h) >> 4);
+    bad |= d ^ ((0x3333333333333333ull << ((64 - len * 8) & 63)) & m);
+
+    // x is already shifted
+    return _atou8w(x, 8);
+}
 
-    return x;
+// Parse uint from string of 1 to 8 chars, or fail
+inline parse_error atou8_checked(const char* s, uint32_t len, uint32_t& out) {
+    assert(len <= 8);
+    uint64_t bad = 0;
+    uint32_t x = _atou8c(s, len, bad);
+    if (unlikely(bad | !len))
+        return parse_invalid;
+    out = x;
+    return parse_ok;
 }
 
-// Parse hex int from string of up to 16 chars
-inline uint64_t htou(const char* s, uint32_t len) {
-    assert(len <= 16);
+// Parse uint64_t from string of 1 to 20 chars, or fail
+// *** More than 20 chars is parse_overflow, even with leading zeros
+inline parse_error atou_checked(const char* s, uint32_t len, uint64_t& out) {
+    if (unlikely(len - 1 >= 20))
+        return len ? parse_overflow : parse_invalid;
+
+    uint64_t bad = 0;
     uint64_t x = 0;
+    bool of = false;
     if (len > 8) {
-        uint32_t lh = len - 8;
-        x = htou8(s, lh);
-        x <<= 32;
+        uint32_t lh = len % 8;
+        x = _atou8c(s, lh, bad);
         len -= lh;
         s += lh;
+        if (len > 8) {
+            // 20 digits overflow if the top 4 are over 1844, or on the add
+            of = x > 1844;
+            x = x * 10000000000000000ull;
+            of |= __builtin_add_overflow(x, _atou8c(s, 8, bad) * 100000000ull, &x);
+            len -= 8;
+            s += 8;
+        }
+        else {
+            x *= 100000000;
+        }
     }
-    return x + htou8(s, len);
+    of |= __builtin_add_overflow(x, _atou8c(s, len, bad), &x);
+
+    if (unlikely(bad))
+        return parse_invalid;
+    if (unlikely(of))
+        return parse_overflow;
+    out = x;
+    return parse_ok;
+}
+
+// Parse _signed_ int64_t from string, or fail. Optional '-' or '+'. No spaces
+// *** More than 20 digits is parse_overflow, even with leading zeros
+inline parse_error atoi_checked(const char* s, uint32_t len, int64_t& out) {
+    bool neg = !!len & (*s == '-');
+    bool ls = !!len & (*s == '-' || *s == '+');
+
+    uint64_t x;
+    parse_error err = atou_checked(s + ls, len - ls, x);
+    if (unlikely(err))
+        return err;
+
+    // Up to 2^63 if negative, 2^63 - 1 if not
+    if (unlikely(x > (1ull << 63) - !neg))
+        return parse_overflow;
+
+    out = neg ? -x : x;
+    return parse_ok;
+}
+
+// Parse hex uint64_t from string of 1 to 16 chars, or fail
+// *** More than 16 chars is parse_overflow, even with leading zeros
+inline parse_error htou_checked(const char* s, uint32_t len, uint64_t& out) {
+    if (unlikely(len - 1 >= 16))
+        return len ? parse_overflow : parse_invalid;
+
+    // Both words htou reads
+    uint32_t lh = len > 8 ? len - 8 : 0;
+    uint64_t w1 = cast<uint64_t>(s);
+    uint64_t w2 = cast<uint64_t>(s + lh);
+    uint64_t bad = ((_hexdigits8(w1) < lh) | (_hexdigits8(w2) < len - lh));
+    if (unlikely(bad))
+        return parse_invalid;
+
+    out = ((uint64_t)_htou8w(w1, lh) << 32) | _htou8w(w2, len - lh);
+    return parse_ok;
 }
 
 //// int to string
 
 // *** p suffix means zero-padded
 
-// Convert uint, of less than 100, to %02u, as int 16
-inline uint16_t utoa2p(uint64_t x) {
-    static const CODE_SECTION uint8_t pairs[50] = { // 0..49, little endian
-        0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90,
-        0x01, 0x11, 0x21, 0x31, 0x41, 0x51, 0x61, 0x71, 0x81, 0x91,
-        0x02, 0x12, 0x22, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92,
-        0x03, 0x13, 0x23, 0x33, 0x43, 0x53, 0x63, 0x73, 0x83, 0x93,
-        0x04, 0x14, 0x24, 0x34, 0x44, 0x54, 0x64, 0x74, 0x84, 0x94,
-    };
+// Tens and ones of 0..49, little endian, for utoa2p.
+// Out of the function, as a constexpr function can't have a static
+inline constexpr CODE_SECTION uint8_t _pairs[50] = {
+    0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90,
+    0x01, 0x11, 0x21, 0x31, 0x41, 0x51, 0x61, 0x71, 0x81, 0x91,
+    0x02, 0x12, 0x22, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92,
+    0x03, 0x13, 0x23, 0x33, 0x43, 0x53, 0x63, 0x73, 0x83, 0x93,
+    0x04, 0x14, 0x24, 0x34, 0x44, 0x54, 0x64, 0x74, 0x84, 0x94,
+};
 
+// Convert uint, of less than 100, to %02u, as int 16
+constexpr uint16_t utoa2p(uint64_t x) {
     uint32_t b50 = -(uint32_t)(x >= 50); // x >= 50 ? ~0 : 0;
     uint32_t x2 = x - (50u & b50);       // x2 = x % 50;
-    uint16_t t = pairs[x2] + (b50 & 5);  // t = pairs[x % 50] + 5 in low nibble if x > 50
+    uint16_t t = _pairs[x2] + (b50 & 5); // t = pairs[x % 50] + 5 in low nibble if x > 50
 
     // move upper nibble to next byte and add '00'
     return ((t | (t << 4)) & 0x0f0f) | 0x3030;
 }
 
 // Convert uint, of less than 100, to %02u
-inline void utoa2p(uint64_t x, char* s) {
-    uint16_t t = utoa2p(x);
-    memcpy(s, &t, sizeof(uint16_t));
+constexpr void utoa2p(uint64_t x, char* s) {
+    _store(s, utoa2p(x));
 }
 
 // Convert uint to %0<N>u, N <= 8
 template <int N>
-inline uint64_t _utoap(uint64_t x, char* s) {
+constexpr uint64_t _utoap(uint64_t x, char* s) {
     static_assert(N <= 8);
 
     uint64_t tmp = utoa2p(x % 100);
@@ -528,17 +2274,77 @@ inline uint64_t _utoap(uint64_t x, char* s) {
     }
 
     tmp >>= (N & 1) * 8;
-    memcpy(s, &tmp, 8);
+    _store(s, tmp);
 
     return x;
 }
 
-// Convert uint to %0<N>u, N <= 20
+#if SWAR_X86
+// Convert two uints, of less than 10^8, to %08u%08u, in one vector.
+// Each is split to 4 digit quarters, a quarter is copied to 4 int16's, and
+// divided by 1000, 100, 10 and 1 with pmulhuw. Digit i is then the
+// quotient i, less 10 times quotient i - 1
+TARGET("sse2")
+inline __m128i _utoa16v(uint32_t hi, uint32_t lo) {
+    // x * 0xd1b71759 >> 45 is x / 10000 below 10^8
+    __m128i x = _mm_set_epi64x(lo, hi);
+    __m128i q = _mm_srli_epi64(_mm_mul_epu32(x, _mm_set1_epi32(0xd1b71759)), 45);
+    __m128i r = _mm_sub_epi32(x, _mm_mul_epu32(q, _mm_set1_epi32(10000)));
+
+    // Quarters, times 4, in int16's 0, 1 (hi) and 4, 5 (lo)
+    __m128i v = _mm_slli_epi16(_mm_or_si128(q, _mm_slli_epi64(r, 16)), 2);
+    __m128i a = _mm_unpacklo_epi16(v, v);
+    __m128i b = _mm_unpackhi_epi16(v, v);
+    a = _mm_unpacklo_epi32(a, a);
+    b = _mm_unpacklo_epi32(b, b);
+
+    // (x * 4 * m >> 16) * k >> 16 is x * m >> 23, 19, 17 and 15
+    __m128i m = _mm_set_epi16(-0x8000, 13108, 5243, 8389, -0x8000, 13108, 5243, 8389);
+    __m128i k = _mm_set_epi16(-0x8000, 1 << 13, 1 << 11, 1 << 7, -0x8000, 1 << 13, 1 << 11, 1 << 7);
+    a = _mm_mulhi_epu16(_mm_mulhi_epu16(a, m), k);
+    b = _mm_mulhi_epu16(_mm_mulhi_epu16(b, m), k);
+
+    // From 1, 12, 123, 1234 to 1, 2, 3, 4
+    __m128i ten = _mm_set1_epi16(10);
+    a = _mm_sub_epi16(a, _mm_slli_epi64(_mm_mullo_epi16(a, ten), 16));
+    b = _mm_sub_epi16(b, _mm_slli_epi64(_mm_mullo_epi16(b, ten), 16));
+
+    return _mm_or_si128(_mm_packus_epi16(a, b), _mm_set1_epi8('0'));
+}
+
+// Convert uint to %0<N>u, 8 < N <= 20, with SSE2.
+// Up to 16 digits are converted and stored at once
+template <int N>
+TARGET("sse2")
+inline void _utoapv(uint64_t x, char* s) {
+    static_assert(N > 8 && N <= 20);
+
+    if constexpr (N <= 16) {
+        // Shift out the leading zeros, past N
+        __m128i v = _utoa16v(x / 100000000, x % 100000000);
+        _mm_storeu_si128((__m128i*)s, _mm_srli_si128(v, 16 - N));
+    }
+    else {
+        // First 1 to 4 digits, then 16, over the rest of the word
+        uint64_t w = _utoa8w(x / 10000000000000000ull) >> ((24 - N) * 8);
+        memcpy(s, &w, 8);
+        x %= 10000000000000000ull;
+        _mm_storeu_si128((__m128i*)(s + N - 16), _utoa16v(x / 100000000, x % 100000000));
+    }
+}
+#endif
+
+// Convert uint, of less than 10^N, to %0<N>u, N <= 20
 template <int N>
-inline char* utoap(uint64_t x, char* s) {
+constexpr char* utoap(uint64_t x, char* s) {
     if constexpr (N <= 8) {
         _utoap<N>(x, s);
     }
+#if SWAR_X86
+    else if (SWAR_MAX_VECWIDTH >= 16 && !SWAR_IS_CONSTANT_EVALUATED()) {
+        _utoapv<N>(x, s);
+    }
+#endif
     else if constexpr (N <= 16) {
         x = _utoap<N - 8>(x, s + 8);
         x /= (N & 1) ? 10 : 100;
@@ -555,36 +2361,80 @@ inline char* utoap(uint64_t x, char* s) {
     return s;
 }
 
-// Convert signed int 32 to string of up to 8 bytes.
-inline uint32_t itoa8(int32_t x, char* buf) {
-    // Handle negatives
-    bool neg = x < 0;
-    *buf = '-'; // Always write
-    buf += neg; // But advance only if negative
-    x = __builtin_abs(x);
+// Powers of 10, for _declen
+inline constexpr CODE_SECTION uint64_t _declen_pow10[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+    10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+    100000000000ull, 1000000000000ull, 10000000000000ull,
+    100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull,
+    10000000000000000000ull };
+
+// Number of decimal digits in x. 1 for 0
+constexpr uint32_t _declen(uint64_t x) {
+    // floor(log10(2) * bits), then one more if x reaches the next power
+    uint32_t t = ((64 - __builtin_clzll(x | 1)) * 1233) >> 12;
+    return t + (x >= _declen_pow10[t]) + (x == 0);
+}
 
-    uint64_t tmp = 0;
-    int n = 0;
+// Convert uint, of less than 10^8, to %08u, as int 64
+constexpr uint64_t _utoa8w(uint32_t x) {
+    // 4 digit halves in int32's, from 12345678 to 0x[5678][1234]
+    uint64_t y = (x / 10000) | ((uint64_t)(x % 10000) << 32);
 
-    // Convert pairs of digits
-    while (x >= 100) {
-        n += 2;
-        tmp <<= 16;
-        tmp |= utoa2p(x % 100);
-        x /= 100;
-    }
+    // 2 digit quarters in int16's, x * 10486 >> 20 is x / 100 below 43699
+    uint64_t t = ((y * 10486) >> 20) & 0x0000007f0000007full;
+    y = ((y - 100 * t) << 16) | t;
+
+    // digits in int8's, x * 103 >> 10 is x / 10 below 179
+    t = ((y * 103) >> 10) & 0x000f000f000f000full;
+    y = ((y - 10 * t) << 8) | t;
 
-    // Last pair - no need to divide any more
-    n += 2;
-    tmp <<= 16;
-    tmp |= utoa2p(x);
+    return y | 0x3030303030303030ull;
+}
+
+// Convert uint64_t to string. String buffer is at least 21 bytes.
+// Constant cost per 8 digits, one branch on their count. Returns length
+constexpr uint32_t utoa(uint64_t x, char* buf) {
+    uint32_t n = _declen(x);
+    if (n <= 8) {
+        uint64_t w = _utoa8w(x) >> ((8 - n) * 8);
+        _store(buf, w);
+    }
+    else if (n <= 16) {
+        uint64_t w = _utoa8w(x / 100000000) >> ((16 - n) * 8);
+        _store(buf, w);
+        w = _utoa8w(x % 100000000);
+        _store(buf + n - 8, w);
+    }
+    else {
+        uint64_t h = x / 10000000000000000ull;
+        uint64_t l = x % 10000000000000000ull;
+        uint64_t w = _utoa8w(h) >> ((24 - n) * 8);
+        _store(buf, w);
+        w = _utoa8w(l / 100000000);
+        _store(buf + n - 16, w);
+        w = _utoa8w(l % 100000000);
+        _store(buf + n - 8, w);
+    }
+    buf[n] = '\0';
+    return n;
+}
 
-    // If last pair is 0<N> we want to remove this "0"
-    n -= x < 10;
-    tmp >>= x < 10 ? 8 : 0;
+// Convert signed int 32, of less than 10^8, to string of up to 8 digits.
+// String buffer is at least 10 bytes. Returns length
+constexpr uint32_t itoa8(int32_t x, char* buf) {
+    // Handle negatives
+    bool neg = x < 0;
+    *buf = '-'; // Always write
+    buf += neg; // But advance only if negative
+    uint32_t u = neg ? 0 - (uint32_t)x : x;
+    assert(u < 100000000);
 
-    // Copy to provided buffer
-    memcpy(buf, &tmp, 8);
+    // Shift out the leading zeros
+    uint32_t n = _declen(u);
+    uint64_t w = _utoa8w(u) >> ((8 - n) * 8);
+    _store(buf, w);
     buf[n] = '\0';
 
     return n + neg;
@@ -592,37 +2442,209 @@ inline uint32_t itoa8(int32_t x, char* buf) {
 
 // Convert signed int 64 to string. String buffer is at least 22 bytes.
 // Returns length
-// *** this feels inefficient :( ***
-inline uint32_t itoa(int64_t x, char* buf) {
-    // Handle negatives
+constexpr uint32_t itoa(int64_t x, char* buf) {
+    // Handle negatives. Unsigned negate, so INT64_MIN is fine
     bool neg = x < 0;
     *buf = '-'; // Always write
     buf += neg; // But advance only if negative
-    x = __builtin_abs(x);
+    return utoa(neg ? 0 - (uint64_t)x : x, buf) + neg;
+}
 
-    char tmp[20];
-    char* p = tmp + 20;
+// High 128 bits of the 256 bit product a * b, from 4 products of 64 bits
+constexpr unsigned __int128 _mulhi128(unsigned __int128 a, unsigned __int128 b) {
+    uint64_t a0 = a, a1 = a >> 64;
+    uint64_t b0 = b, b1 = b >> 64;
+    unsigned __int128 p00 = (unsigned __int128)a0 * b0;
+    unsigned __int128 p01 = (unsigned __int128)a0 * b1;
+    unsigned __int128 p10 = (unsigned __int128)a1 * b0;
+    unsigned __int128 p11 = (unsigned __int128)a1 * b1;
+
+    // Carry of the middle 64 bits
+    unsigned __int128 mid = (p00 >> 64) + (uint64_t)p01 + (uint64_t)p10;
+    return p11 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+}
 
-    while (x >= 100) {
-        p -= 2;
-        utoa2p(x % 100, p);
-        x /= 100;
+// Divide by 10^16, with a reciprocal multiply.
+// x / 10^16 is (x >> 16) / 5^16. Below 2^112, that is exactly
+// (x >> 16) * ceil(2^150 / 5^16) >> 150, and the reciprocal fits 113 bits
+constexpr unsigned __int128 _div1e16(unsigned __int128 x) {
+    unsigned __int128 m = ((unsigned __int128)0x1cd2b297d889bull << 64) | 0xc2b6985d7cd0f314ull;
+    return _mulhi128(x >> 16, m) >> 22;
+}
+
+// Convert unsigned __int128 to string. String buffer is at least 40 bytes.
+// Constant cost per 16 digits. Returns length
+constexpr uint32_t utoa128(unsigned __int128 x, char* buf) {
+    if (!(x >> 64))
+        return utoa((uint64_t)x, buf);
+
+    // 20 to 39 digits. The last 16, the 16 before them, and up to 7 more.
+    // Below 2^75, q / 10^16 is (q >> 16) / 5^16, in 64 bits
+    unsigned __int128 q = _div1e16(x);
+    uint64_t low = (uint64_t)(x - q * 10000000000000000ull);
+    uint64_t top = (uint64_t)(q >> 16) / 152587890625ull;
+    uint64_t mid = (uint64_t)(q - (unsigned __int128)top * 10000000000000000ull);
+
+    char* p = buf;
+    if (top) {
+        p += utoa(top, p);
+        utoap<16>(mid, p);
+        p += 16;
+    }
+    else {
+        p += utoa(mid, p);
     }
+    utoap<16>(low, p);
+    return p + 16 - buf;
+}
+
+// Convert signed __int128 to string. String buffer is at least 41 bytes.
+// Returns length
+constexpr uint32_t itoa128(__int128 x, char* buf) {
+    // Handle negatives. Unsigned negate, so the minimum is fine
+    bool neg = x < 0;
+    *buf = '-'; // Always write
+    buf += neg; // But advance only if negative
+    return utoa128(neg ? 0 - (unsigned __int128)x : x, buf) + neg;
+}
 
-    p -= 2;
-    utoa2p(x, p);
-    
-    p += x < 10;
+//// int to hex string
 
-    uint32_t len = tmp + 20 - p;
+// Convert uint32 to %08x, or %08X, as int 64
+template <bool Upper>
+inline uint64_t _utoh8w(uint32_t x) {
+    // Most significant byte first. 0x12345678 to 0x[78][56][34][12]
+    uint64_t y = __builtin_bswap32(x);
 
-    memcpy(buf, p, 20);
-    buf[len] = '\0';
+    // One byte per int16, from 0x00000000[78563412] to 0x00[78]00[56]00[34]00[12]
+    y = (y | (y << 16)) & 0x0000ffff0000ffffull;
+    y = (y | (y << 8)) & 0x00ff00ff00ff00ffull;
 
-    return len + neg;
+    // One nibble per int8, high nibble first. 0x0034 to 0x0403
+    y = ((y >> 4) & 0x000f000f000f000full) | ((y & 0x000f000f000f000full) << 8);
+
+    // The inverse of htou8. Nibbles above 9 carry into bit 4 when adding 6,
+    // and get 'a' - '0' - 10, or 'A' - '0' - 10, more than '0'
+    uint64_t af = ((y + 0x0606060606060606ull) >> 4) & 0x0101010101010101ull;
+    return y + 0x3030303030303030ull + af * (Upper ? 'A' - '0' - 10 : 'a' - '0' - 10);
 }
 
-//// Double to string
+// Convert uint32 to %08x, or %08X if Upper
+template <bool Upper>
+inline char* utoh8p(uint32_t x, char* s) {
+    uint64_t w = _utoh8w<Upper>(x);
+    memcpy(s, &w, 8);
+    s[8] = '\0';
+    return s;
+}
+
+// Convert uint32 to %x, or %X if Upper. String buffer is at least 9 bytes.
+// Returns length
+template <bool Upper>
+inline uint32_t utoh8(uint32_t x, char* buf) {
+    // Shift out the leading zeros, keep one for 0
+    uint32_t n = (35 - __builtin_clz(x | 1)) / 4;
+    uint64_t w = _utoh8w<Upper>(x) >> ((8 - n) * 8);
+    memcpy(buf, &w, 8);
+    buf[n] = '\0';
+    return n;
+}
+
+// Convert uint64 to %016lx, or %016lX if Upper
+template <bool Upper>
+inline char* utohp(uint64_t x, char* s) {
+    uint64_t hi = _utoh8w<Upper>(x >> 32);
+    uint64_t lo = _utoh8w<Upper>(x);
+    memcpy(s, &hi, 8);
+    memcpy(s + 8, &lo, 8);
+    s[16] = '\0';
+    return s;
+}
+
+// Convert uint64 to %lx, or %lX if Upper. String buffer is at least 17 bytes.
+// One branch on the number of words. Returns length
+template <bool Upper>
+inline uint32_t utoh(uint64_t x, char* buf) {
+    uint32_t n = (67 - __builtin_clzll(x | 1)) / 4;
+    if (n <= 8)
+        return utoh8<Upper>(x, buf);
+
+    uint64_t w = _utoh8w<Upper>(x >> 32) >> ((16 - n) * 8);
+    memcpy(buf, &w, 8);
+    w = _utoh8w<Upper>(x);
+    memcpy(buf + n - 8, &w, 8);
+    buf[n] = '\0';
+    return n;
+}
+
+// Write 4 bytes of hex from word w, each followed by a space, as 12 chars.
+// Writes 14 bytes
+inline void _hexdump4(uint64_t w, char* d) {
+    // From [h0 l0 h1 l1] to [h0 l0 ' ' h1 l1 ' ']
+    const uint64_t sp = 0x0000200000200000ull;
+    uint64_t a = (w & 0xffff) | ((w & 0xffff0000ull) << 8) | sp;
+    w >>= 32;
+    uint64_t b = (w & 0xffff) | ((w & 0xffff0000ull) << 8) | sp;
+    memcpy(d, &a, 8);
+    memcpy(d + 6, &b, 8);
+}
+
+// Write one line of hexdump for n <= 16 bytes in 16 byte buffer p.
+// Writes up to 79 bytes. Returns the line length
+inline uint32_t _hexdump16(const char* p, uint32_t n, uint32_t off, char* d) {
+    // Offset, and 2 spaces
+    uint64_t w = _utoh8w<false>(off);
+    memcpy(d, &w, 8);
+    memcpy(d + 8, "  ", 2);
+
+    // Hex, in 2 groups of 8 bytes, with 2 spaces between the groups
+    for (int i = 0; i < 16; i += 4) {
+        uint32_t x = cast<uint32_t>(p + i);
+        _hexdump4(_utoh8w<false>(__builtin_bswap32(x)), d + 10 + i * 3 + (i >= 8));
+    }
+    d[34] = ' ';
+
+    // Blanks for the bytes of a short line
+    uint32_t h = 10 + n * 3 + (n > 8);
+    memset(d + h, ' ', 60 - h);
+    d[60] = '|';
+
+    // Printable chars as they are, others as '.'
+    for (int i = 0; i < 16; i += 8) {
+        uint64_t x = cast<uint64_t>(p + i);
+        uint64_t np = ~_bytesbetween(x, 0x20, 0x7e) & 0x8080808080808080ull;
+        np = (np >> 7) * 0xff;
+        x = (x & ~np) | (0x2e2e2e2e2e2e2e2eull & np);
+        memcpy(d + 61 + i, &x, 8);
+    }
+    d[61 + n] = '|';
+    d[62 + n] = '\n';
+
+    return 63 + n;
+}
+
+// Format bytes like hexdump -C, 16 per line, without snprintf.
+// Returns length
+inline size_t hexdump(const void* p, size_t len, char* buf) {
+    const char* s = (const char*)p;
+    char* d = buf;
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16)
+        d += _hexdump16(s + i, 16, i, d);
+
+    // Copy the last bytes, so nothing is read past the end
+    if (i < len) {
+        char tmp[16] = {};
+        memcpy(tmp, s + i, len - i);
+        d += _hexdump16(tmp, len - i, i, d);
+    }
+
+    *d = '\0';
+    return d - buf;
+}
+
+//// String to double
 
 // Copy the sign from src to dst that is unsigned.
 // *** dst is up to 63 bit
@@ -632,35 +2654,2080 @@ inline int64_t _copySign(int64_t src, uint64_t dst) {
     return (dst + m) ^ m; // flip if src negative
 }
 
-// Parse double from string
-// *** More than 20 char integer part returns junk.
-// *** Too much decimal char will get lost to precision
+// Add the leading digits of [p, end) to w. More than 19 digits wrap.
+// Returns the end of the digits
+inline const char* _atod_digits(const char* p, const char* end, uint64_t& w) {
+    static const CODE_SECTION uint32_t scales[9] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+    for (;;) {
+        // Stop at end, so a multiple of 8 digits does not load a word at it
+        uint32_t avail = end - p;
+        if (avail == 0)
+            break;
+
+        uint64_t x = cast<uint64_t>(p);
+        uint32_t n = _digits8(x);
+        n = n < avail ? n : avail;
+
+        w = w * scales[n] + _atou8w(x, n);
+        p += n;
+        if (n < 8)
+            break;
+    }
+    return p;
+}
+
+// Count the up to 8 digits of a fraction at f, in n.
+// Returns false if there may be more
+inline bool _atod_frac8(const char* f, const char* end, uint32_t& n) {
+    uint32_t avail = end - f;
+    n = _digits8(cast<uint64_t>(f));
+    n = n < avail ? n : avail;
+    return n < 8 || n == avail;
+}
+
+// Add the leading digits of [p, end) to w, up to 19 significant digits.
+// Digits past that are counted in dropped, and set trunc if not all '0'.
+// Returns the end of the digits
+inline const char* _atod_digits(const char* p, const char* end, uint64_t& w,
+                                uint32_t& nd, uint32_t& dropped, bool& trunc) {
+    static const CODE_SECTION uint32_t scales[9] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+    for (;;) {
+        uint32_t avail = end - p;
+        if (avail == 0)
+            break;
+
+        // One load to count the digits and to parse them
+        uint64_t x = cast<uint64_t>(p);
+        uint32_t n = _digits8(x);
+        n = n < avail ? n : avail;
+        p += n;
+
+        // leading zeros are not significant
+        uint32_t sig = n;
+        if (nd == 0) {
+            uint64_t t = x ^ 0x3030303030303030ull;
+            uint32_t z = t ? __builtin_ctzll(t) / 8 : 8;
+            z = z < n ? z : n;
+            x = x >> (z * 4) >> (z * 4);
+            sig -= z;
+        }
+
+        uint32_t k = 19 - nd;
+        k = sig < k ? sig : k;
+        w = w * scales[k] + _atou8w(x, k);
+        nd += k;
+
+        // digits past 19, only their count and if any is not '0' matter
+        if (unlikely(k < sig)) {
+            x = x >> (k * 4) >> (k * 4);
+            trunc |= (x & 0x0f0f0f0f0f0f0f0full & _bytesmask(sig - k)) != 0;
+            dropped += sig - k;
+        }
+
+        if (n < 8)
+            break;
+    }
+    return p;
+}
+
+// Correctly rounded w * 10^q, as the bits of a positive double.
+// Returns -1 if the 128 bit product is not enough to tell.
+// 1 <= w, -342 <= q <= 308.
+// Eisel-Lemire, like in Lemire, Number Parsing at a Gigabyte per Second
+inline int64_t _eisel_lemire(uint64_t w, int32_t q) {
+    // 5^q, normalized to 128 bits. Truncated, or plus 1 if q < 0
+    // Array of 651 * 16 = 10416 bytes
+    static const CODE_SECTION uint64_t pow5[651 * 2] = {
+        0xeef453d6923bd65aull, 0x113faa2906a13b3full, // 5^-342
+        0x9558b4661b6565f8ull, 0x4ac7ca59a424c507ull, // 5^-341
+        0xbaaee17fa23ebf76ull, 0x5d79bcf00d2df649ull, // 5^-340
+        0xe95a99df8ace6f53ull, 0xf4d82c2c107973dcull, // 5^-339
+        0x91d8a02bb6c10594ull, 0x79071b9b8a4be869ull, // 5^-338
+        0xb64ec836a47146f9ull, 0x9748e2826cdee284ull, // 5^-337
+        0xe3e27a444d8d98b7ull, 0xfd1b1b2308169b25ull, // 5^-336
+        0x8e6d8c6ab0787f72ull, 0xfe30f0f5e50e20f7ull, // 5^-335
+        0xb208ef855c969f4full, 0xbdbd2d335e51a935ull, // 5^-334
+        0xde8b2b66b3bc4723ull, 0xad2c788035e61382ull, // 5^-333
+        0x8b16fb203055ac76ull, 0x4c3bcb5021afcc31ull, // 5^-332
+        0xaddcb9e83c6b1793ull, 0xdf4abe242a1bbf3dull, // 5^-331
+        0xd953e8624b85dd78ull, 0xd71d6dad34a2af0dull, // 5^-330
+        0x87d4713d6f33aa6bull, 0x8672648c40e5ad68ull, // 5^-329
+        0xa9c98d8ccb009506ull, 0x680efdaf511f18c2ull, // 5^-328
+        0xd43bf0effdc0ba48ull, 0x0212bd1b2566def2ull, // 5^-327
+        0x84a57695fe98746dull, 0x014bb630f7604b57ull, // 5^-326
+        0xa5ced43b7e3e9188ull, 0x419ea3bd35385e2dull, // 5^-325
+        0xcf42894a5dce35eaull, 0x52064cac828675b9ull, // 5^-324
+        0x818995ce7aa0e1b2ull, 0x7343efebd1940993ull, // 5^-323
+        0xa1ebfb4219491a1full, 0x1014ebe6c5f90bf8ull, // 5^-322
+        0xca66fa129f9b60a6ull, 0xd41a26e077774ef6ull, // 5^-321
+        0xfd00b897478238d0ull, 0x8920b098955522b4ull, // 5^-320
+        0x9e20735e8cb16382ull, 0x55b46e5f5d5535b0ull, // 5^-319
+        0xc5a890362fddbc62ull, 0xeb2189f734aa831dull, // 5^-318
+        0xf712b443bbd52b7bull, 0xa5e9ec7501d523e4ull, // 5^-317
+        0x9a6bb0aa55653b2dull, 0x47b233c92125366eull, // 5^-316
+        0xc1069cd4eabe89f8ull, 0x999ec0bb696e840aull, // 5^-315
+        0xf148440a256e2c76ull, 0xc00670ea43ca250dull, // 5^-314
+        0x96cd2a865764dbcaull, 0x380406926a5e5728ull, // 5^-313
+        0xbc807527ed3e12bcull, 0xc605083704f5ecf2ull, // 5^-312
+        0xeba09271e88d976bull, 0xf7864a44c633682eull, // 5^-311
+        0x93445b8731587ea3ull, 0x7ab3ee6afbe0211dull, // 5^-310
+        0xb8157268fdae9e4cull, 0x5960ea05bad82964ull, // 5^-309
+        0xe61acf033d1a45dfull, 0x6fb92487298e33bdull, // 5^-308
+        0x8fd0c16206306babull, 0xa5d3b6d479f8e056ull, // 5^-307
+        0xb3c4f1ba87bc8696ull, 0x8f48a4899877186cull, // 5^-306
+        0xe0b62e2929aba83cull, 0x331acdabfe94de87ull, // 5^-305
+        0x8c71dcd9ba0b4925ull, 0x9ff0c08b7f1d0b14ull, // 5^-304
+        0xaf8e5410288e1b6full, 0x07ecf0ae5ee44dd9ull, // 5^-303
+        0xdb71e91432b1a24aull, 0xc9e82cd9f69d6150ull, // 5^-302
+        0x892731ac9faf056eull, 0xbe311c083a225cd2ull, // 5^-301
+        0xab70fe17c79ac6caull, 0x6dbd630a48aaf406ull, // 5^-300
+        0xd64d3d9db981787dull, 0x092cbbccdad5b108ull, // 5^-299
+        0x85f0468293f0eb4eull, 0x25bbf56008c58ea5ull, // 5^-298
+        0xa76c582338ed2621ull, 0xaf2af2b80af6f24eull, // 5^-297
+        0xd1476e2c07286faaull, 0x1af5af660db4aee1ull, // 5^-296
+        0x82cca4db847945caull, 0x50d98d9fc890ed4dull, // 5^-295
+        0xa37fce126597973cull, 0xe50ff107bab528a0ull, // 5^-294
+        0xcc5fc196fefd7d0cull, 0x1e53ed49a96272c8ull, // 5^-293
+        0xff77b1fcbebcdc4full, 0x25e8e89c13bb0f7aull, // 5^-292
+        0x9faacf3df73609b1ull, 0x77b191618c54e9acull, // 5^-291
+        0xc795830d75038c1dull, 0xd59df5b9ef6a2417ull, // 5^-290
+        0xf97ae3d0d2446f25ull, 0x4b0573286b44ad1dull, // 5^-289
+        0x9becce62836ac577ull, 0x4ee367f9430aec32ull, // 5^-288
+        0xc2e801fb244576d5ull, 0x229c41f793cda73full, // 5^-287
+        0xf3a20279ed56d48aull, 0x6b43527578c1110full, // 5^-286
+        0x9845418c345644d6ull, 0x830a13896b78aaa9ull, // 5^-285
+        0xbe5691ef416bd60cull, 0x23cc986bc656d553ull, // 5^-284
+        0xedec366b11c6cb8full, 0x2cbfbe86b7ec8aa8ull, // 5^-283
+        0x94b3a202eb1c3f39ull, 0x7bf7d71432f3d6a9ull, // 5^-282
+        0xb9e08a83a5e34f07ull, 0xdaf5ccd93fb0cc53ull, // 5^-281
+        0xe858ad248f5c22c9ull, 0xd1b3400f8f9cff68ull, // 5^-280
+        0x91376c36d99995beull, 0x23100809b9c21fa1ull, // 5^-279
+        0xb58547448ffffb2dull, 0xabd40a0c2832a78aull, // 5^-278
+        0xe2e69915b3fff9f9ull, 0x16c90c8f323f516cull, // 5^-277
+        0x8dd01fad907ffc3bull, 0xae3da7d97f6792e3ull, // 5^-276
+        0xb1442798f49ffb4aull, 0x99cd11cfdf41779cull, // 5^-275
+        0xdd95317f31c7fa1dull, 0x40405643d711d583ull, // 5^-274
+        0x8a7d3eef7f1cfc52ull, 0x482835ea666b2572ull, // 5^-273
+        0xad1c8eab5ee43b66ull, 0xda3243650005eecfull, // 5^-272
+        0xd863b256369d4a40ull, 0x90bed43e40076a82ull, // 5^-271
+        0x873e4f75e2224e68ull, 0x5a7744a6e804a291ull, // 5^-270
+        0xa90de3535aaae202ull, 0x711515d0a205cb36ull, // 5^-269
+        0xd3515c2831559a83ull, 0x0d5a5b44ca873e03ull, // 5^-268
+        0x8412d9991ed58091ull, 0xe858790afe9486c2ull, // 5^-267
+        0xa5178fff668ae0b6ull, 0x626e974dbe39a872ull, // 5^-266
+        0xce5d73ff402d98e3ull, 0xfb0a3d212dc8128full, // 5^-265
+        0x80fa687f881c7f8eull, 0x7ce66634bc9d0b99ull, // 5^-264
+        0xa139029f6a239f72ull, 0x1c1fffc1ebc44e80ull, // 5^-263
+        0xc987434744ac874eull, 0xa327ffb266b56220ull, // 5^-262
+        0xfbe9141915d7a922ull, 0x4bf1ff9f0062baa8ull, // 5^-261
+        0x9d71ac8fada6c9b5ull, 0x6f773fc3603db4a9ull, // 5^-260
+        0xc4ce17b399107c22ull, 0xcb550fb4384d21d3ull, // 5^-259
+        0xf6019da07f549b2bull, 0x7e2a53a146606a48ull, // 5^-258
+        0x99c102844f94e0fbull, 0x2eda7444cbfc426dull, // 5^-257
+        0xc0314325637a1939ull, 0xfa911155fefb5308ull, // 5^-256
+        0xf03d93eebc589f88ull, 0x793555ab7eba27caull, // 5^-255
+        0x96267c7535b763b5ull, 0x4bc1558b2f3458deull, // 5^-254
+        0xbbb01b9283253ca2ull, 0x9eb1aaedfb016f16ull, // 5^-253
+        0xea9c227723ee8bcbull, 0x465e15a979c1cadcull, // 5^-252
+        0x92a1958a7675175full, 0x0bfacd89ec191ec9ull, // 5^-251
+        0xb749faed14125d36ull, 0xcef980ec671f667bull, // 5^-250
+        0xe51c79a85916f484ull, 0x82b7e12780e7401aull, // 5^-249
+        0x8f31cc0937ae58d2ull, 0xd1b2ecb8b0908810ull, // 5^-248
+        0xb2fe3f0b8599ef07ull, 0x861fa7e6dcb4aa15ull, // 5^-247
+        0xdfbdcece67006ac9ull, 0x67a791e093e1d49aull, // 5^-246
+        0x8bd6a141006042bdull, 0xe0c8bb2c5c6d24e0ull, // 5^-245
+        0xaecc49914078536dull, 0x58fae9f773886e18ull, // 5^-244
+        0xda7f5bf590966848ull, 0xaf39a475506a899eull, // 5^-243
+        0x888f99797a5e012dull, 0x6d8406c952429603ull, // 5^-242
+        0xaab37fd7d8f58178ull, 0xc8e5087ba6d33b83ull, // 5^-241
+        0xd5605fcdcf32e1d6ull, 0xfb1e4a9a90880a64ull, // 5^-240
+        0x855c3be0a17fcd26ull, 0x5cf2eea09a55067full, // 5^-239
+        0xa6b34ad8c9dfc06full, 0xf42faa48c0ea481eull, // 5^-238
+        0xd0601d8efc57b08bull, 0xf13b94daf124da26ull, // 5^-237
+        0x823c12795db6ce57ull, 0x76c53d08d6b70858ull, // 5^-236
+        0xa2cb1717b52481edull, 0x54768c4b0c64ca6eull, // 5^-235
+        0xcb7ddcdda26da268ull, 0xa9942f5dcf7dfd09ull, // 5^-234
+        0xfe5d54150b090b02ull, 0xd3f93b35435d7c4cull, // 5^-233
+        0x9efa548d26e5a6e1ull, 0xc47bc5014a1a6dafull, // 5^-232
+        0xc6b8e9b0709f109aull, 0x359ab6419ca1091bull, // 5^-231
+        0xf867241c8cc6d4c0ull, 0xc30163d203c94b62ull, // 5^-230
+        0x9b407691d7fc44f8ull, 0x79e0de63425dcf1dull, // 5^-229
+        0xc21094364dfb5636ull, 0x985915fc12f542e4ull, // 5^-228
+        0xf294b943e17a2bc4ull, 0x3e6f5b7b17b2939dull, // 5^-227
+        0x979cf3ca6cec5b5aull, 0xa705992ceecf9c42ull, // 5^-226
+        0xbd8430bd08277231ull, 0x50c6ff782a838353ull, // 5^-225
+        0xece53cec4a314ebdull, 0xa4f8bf5635246428ull, // 5^-224
+        0x940f4613ae5ed136ull, 0x871b7795e136be99ull, // 5^-223
+        0xb913179899f68584ull, 0x28e2557b59846e3full, // 5^-222
+        0xe757dd7ec07426e5ull, 0x331aeada2fe589cfull, // 5^-221
+        0x9096ea6f3848984full, 0x3ff0d2c85def7621ull, // 5^-220
+        0xb4bca50b065abe63ull, 0x0fed077a756b53a9ull, // 5^-219
+        0xe1ebce4dc7f16dfbull, 0xd3e8495912c62894ull, // 5^-218
+        0x8d3360f09cf6e4bdull, 0x64712dd7abbbd95cull, // 5^-217
+        0xb080392cc4349decull, 0xbd8d794d96aacfb3ull, // 5^-216
+        0xdca04777f541c567ull, 0xecf0d7a0fc5583a0ull, // 5^-215
+        0x89e42caaf9491b60ull, 0xf41686c49db57244ull, // 5^-214
+        0xac5d37d5b79b6239ull, 0x311c2875c522ced5ull, // 5^-213
+        0xd77485cb25823ac7ull, 0x7d633293366b828bull, // 5^-212
+        0x86a8d39ef77164bcull, 0xae5dff9c02033197ull, // 5^-211
+        0xa8530886b54dbdebull, 0xd9f57f830283fdfcull, // 5^-210
+        0xd267caa862a12d66ull, 0xd072df63c324fd7bull, // 5^-209
+        0x8380dea93da4bc60ull, 0x4247cb9e59f71e6dull, // 5^-208
+        0xa46116538d0deb78ull, 0x52d9be85f074e608ull, // 5^-207
+        0xcd795be870516656ull, 0x67902e276c921f8bull, // 5^-206
+        0x806bd9714632dff6ull, 0x00ba1cd8a3db53b6ull, // 5^-205
+        0xa086cfcd97bf97f3ull, 0x80e8a40eccd228a4ull, // 5^-204
+        0xc8a883c0fdaf7df0ull, 0x6122cd128006b2cdull, // 5^-203
+        0xfad2a4b13d1b5d6cull, 0x796b805720085f81ull, // 5^-202
+        0x9cc3a6eec6311a63ull, 0xcbe3303674053bb0ull, // 5^-201
+        0xc3f490aa77bd60fcull, 0xbedbfc4411068a9cull, // 5^-200
+        0xf4f1b4d515acb93bull, 0xee92fb5515482d44ull, // 5^-199
+        0x991711052d8bf3c5ull, 0x751bdd152d4d1c4aull, // 5^-198
+        0xbf5cd54678eef0b6ull, 0xd262d45a78a0635dull, // 5^-197
+        0xef340a98172aace4ull, 0x86fb897116c87c34ull, // 5^-196
+        0x9580869f0e7aac0eull, 0xd45d35e6ae3d4da0ull, // 5^-195
+        0xbae0a846d2195712ull, 0x8974836059cca109ull, // 5^-194
+        0xe998d258869facd7ull, 0x2bd1a438703fc94bull, // 5^-193
+        0x91ff83775423cc06ull, 0x7b6306a34627ddcfull, // 5^-192
+        0xb67f6455292cbf08ull, 0x1a3bc84c17b1d542ull, // 5^-191
+        0xe41f3d6a7377eecaull, 0x20caba5f1d9e4a93ull, // 5^-190
+        0x8e938662882af53eull, 0x547eb47b7282ee9cull, // 5^-189
+        0xb23867fb2a35b28dull, 0xe99e619a4f23aa43ull, // 5^-188
+        0xdec681f9f4c31f31ull, 0x6405fa00e2ec94d4ull, // 5^-187
+        0x8b3c113c38f9f37eull, 0xde83bc408dd3dd04ull, // 5^-186
+        0xae0b158b4738705eull, 0x9624ab50b148d445ull, // 5^-185
+        0xd98ddaee19068c76ull, 0x3badd624dd9b0957ull, // 5^-184
+        0x87f8a8d4cfa417c9ull, 0xe54ca5d70a80e5d6ull, // 5^-183
+        0xa9f6d30a038d1dbcull, 0x5e9fcf4ccd211f4cull, // 5^-182
+        0xd47487cc8470652bull, 0x7647c3200069671full, // 5^-181
+        0x84c8d4dfd2c63f3bull, 0x29ecd9f40041e073ull, // 5^-180
+        0xa5fb0a17c777cf09ull, 0xf468107100525890ull, // 5^-179
+        0xcf79cc9db955c2ccull, 0x7182148d4066eeb4ull, // 5^-178
+        0x81ac1fe293d599bfull, 0xc6f14cd848405530ull, // 5^-177
+        0xa21727db38cb002full, 0xb8ada00e5a506a7cull, // 5^-176
+        0xca9cf1d206fdc03bull, 0xa6d90811f0e4851cull, // 5^-175
+        0xfd442e4688bd304aull, 0x908f4a166d1da663ull, // 5^-174
+        0x9e4a9cec15763e2eull, 0x9a598e4e043287feull, // 5^-173
+        0xc5dd44271ad3cdbaull, 0x40eff1e1853f29fdull, // 5^-172
+        0xf7549530e188c128ull, 0xd12bee59e68ef47cull, // 5^-171
+        0x9a94dd3e8cf578b9ull, 0x82bb74f8301958ceull, // 5^-170
+        0xc13a148e3032d6e7ull, 0xe36a52363c1faf01ull, // 5^-169
+        0xf18899b1bc3f8ca1ull, 0xdc44e6c3cb279ac1ull, // 5^-168
+        0x96f5600f15a7b7e5ull, 0x29ab103a5ef8c0b9ull, // 5^-167
+        0xbcb2b812db11a5deull, 0x7415d448f6b6f0e7ull, // 5^-166
+        0xebdf661791d60f56ull, 0x111b495b3464ad21ull, // 5^-165
+        0x936b9fcebb25c995ull, 0xcab10dd900beec34ull, // 5^-164
+        0xb84687c269ef3bfbull, 0x3d5d514f40eea742ull, // 5^-163
+        0xe65829b3046b0afaull, 0x0cb4a5a3112a5112ull, // 5^-162
+        0x8ff71a0fe2c2e6dcull, 0x47f0e785eaba72abull, // 5^-161
+        0xb3f4e093db73a093ull, 0x59ed216765690f56ull, // 5^-160
+        0xe0f218b8d25088b8ull, 0x306869c13ec3532cull, // 5^-159
+        0x8c974f7383725573ull, 0x1e414218c73a13fbull, // 5^-158
+        0xafbd2350644eeacfull, 0xe5d1929ef90898faull, // 5^-157
+        0xdbac6c247d62a583ull, 0xdf45f746b74abf39ull, // 5^-156
+        0x894bc396ce5da772ull, 0x6b8bba8c328eb783ull, // 5^-155
+        0xab9eb47c81f5114full, 0x066ea92f3f326564ull, // 5^-154
+        0xd686619ba27255a2ull, 0xc80a537b0efefebdull, // 5^-153
+        0x8613fd0145877585ull, 0xbd06742ce95f5f36ull, // 5^-152
+        0xa798fc4196e952e7ull, 0x2c48113823b73704ull, // 5^-151
+        0xd17f3b51fca3a7a0ull, 0xf75a15862ca504c5ull, // 5^-150
+        0x82ef85133de648c4ull, 0x9a984d73dbe722fbull, // 5^-149
+        0xa3ab66580d5fdaf5ull, 0xc13e60d0d2e0ebbaull, // 5^-148
+        0xcc963fee10b7d1b3ull, 0x318df905079926a8ull, // 5^-147
+        0xffbbcfe994e5c61full, 0xfdf17746497f7052ull, // 5^-146
+        0x9fd561f1fd0f9bd3ull, 0xfeb6ea8bedefa633ull, // 5^-145
+        0xc7caba6e7c5382c8ull, 0xfe64a52ee96b8fc0ull, // 5^-144
+        0xf9bd690a1b68637bull, 0x3dfdce7aa3c673b0ull, // 5^-143
+        0x9c1661a651213e2dull, 0x06bea10ca65c084eull, // 5^-142
+        0xc31bfa0fe5698db8ull, 0x486e494fcff30a62ull, // 5^-141
+        0xf3e2f893dec3f126ull, 0x5a89dba3c3efccfaull, // 5^-140
+        0x986ddb5c6b3a76b7ull, 0xf89629465a75e01cull, // 5^-139
+        0xbe89523386091465ull, 0xf6bbb397f1135823ull, // 5^-138
+        0xee2ba6c0678b597full, 0x746aa07ded582e2cull, // 5^-137
+        0x94db483840b717efull, 0xa8c2a44eb4571cdcull, // 5^-136
+        0xba121a4650e4ddebull, 0x92f34d62616ce413ull, // 5^-135
+        0xe896a0d7e51e1566ull, 0x77b020baf9c81d17ull, // 5^-134
+        0x915e2486ef32cd60ull, 0x0ace1474dc1d122eull, // 5^-133
+        0xb5b5ada8aaff80b8ull, 0x0d819992132456baull, // 5^-132
+        0xe3231912d5bf60e6ull, 0x10e1fff697ed6c69ull, // 5^-131
+        0x8df5efabc5979c8full, 0xca8d3ffa1ef463c1ull, // 5^-130
+        0xb1736b96b6fd83b3ull, 0xbd308ff8a6b17cb2ull, // 5^-129
+        0xddd0467c64bce4a0ull, 0xac7cb3f6d05ddbdeull, // 5^-128
+        0x8aa22c0dbef60ee4ull, 0x6bcdf07a423aa96bull, // 5^-127
+        0xad4ab7112eb3929dull, 0x86c16c98d2c953c6ull, // 5^-126
+        0xd89d64d57a607744ull, 0xe871c7bf077ba8b7ull, // 5^-125
+        0x87625f056c7c4a8bull, 0x11471cd764ad4972ull, // 5^-124
+        0xa93af6c6c79b5d2dull, 0xd598e40d3dd89bcfull, // 5^-123
+        0xd389b47879823479ull, 0x4aff1d108d4ec2c3ull, // 5^-122
+        0x843610cb4bf160cbull, 0xcedf722a585139baull, // 5^-121
+        0xa54394fe1eedb8feull, 0xc2974eb4ee658828ull, // 5^-120
+        0xce947a3da6a9273eull, 0x733d226229feea32ull, // 5^-119
+        0x811ccc668829b887ull, 0x0806357d5a3f525full, // 5^-118
+        0xa163ff802a3426a8ull, 0xca07c2dcb0cf26f7ull, // 5^-117
+        0xc9bcff6034c13052ull, 0xfc89b393dd02f0b5ull, // 5^-116
+        0xfc2c3f3841f17c67ull, 0xbbac2078d443ace2ull, // 5^-115
+        0x9d9ba7832936edc0ull, 0xd54b944b84aa4c0dull, // 5^-114
+        0xc5029163f384a931ull, 0x0a9e795e65d4df11ull, // 5^-113
+        0xf64335bcf065d37dull, 0x4d4617b5ff4a16d5ull, // 5^-112
+        0x99ea0196163fa42eull, 0x504bced1bf8e4e45ull, // 5^-111
+        0xc06481fb9bcf8d39ull, 0xe45ec2862f71e1d6ull, // 5^-110
+        0xf07da27a82c37088ull, 0x5d767327bb4e5a4cull, // 5^-109
+        0x964e858c91ba2655ull, 0x3a6a07f8d510f86full, // 5^-108
+        0xbbe226efb628afeaull, 0x890489f70a55368bull, // 5^-107
+        0xeadab0aba3b2dbe5ull, 0x2b45ac74ccea842eull, // 5^-106
+        0x92c8ae6b464fc96full, 0x3b0b8bc90012929dull, // 5^-105
+        0xb77ada0617e3bbcbull, 0x09ce6ebb40173744ull, // 5^-104
+        0xe55990879ddcaabdull, 0xcc420a6a101d0515ull, // 5^-103
+        0x8f57fa54c2a9eab6ull, 0x9fa946824a12232dull, // 5^-102
+        0xb32df8e9f3546564ull, 0x47939822dc96abf9ull, // 5^-101
+        0xdff9772470297ebdull, 0x59787e2b93bc56f7ull, // 5^-100
+        0x8bfbea76c619ef36ull, 0x57eb4edb3c55b65aull, // 5^-99
+        0xaefae51477a06b03ull, 0xede622920b6b23f1ull, // 5^-98
+        0xdab99e59958885c4ull, 0xe95fab368e45ecedull, // 5^-97
+        0x88b402f7fd75539bull, 0x11dbcb0218ebb414ull, // 5^-96
+        0xaae103b5fcd2a881ull, 0xd652bdc29f26a119ull, // 5^-95
+        0xd59944a37c0752a2ull, 0x4be76d3346f0495full, // 5^-94
+        0x857fcae62d8493a5ull, 0x6f70a4400c562ddbull, // 5^-93
+        0xa6dfbd9fb8e5b88eull, 0xcb4ccd500f6bb952ull, // 5^-92
+        0xd097ad07a71f26b2ull, 0x7e2000a41346a7a7ull, // 5^-91
+        0x825ecc24c873782full, 0x8ed400668c0c28c8ull, // 5^-90
+        0xa2f67f2dfa90563bull, 0x728900802f0f32faull, // 5^-89
+        0xcbb41ef979346bcaull, 0x4f2b40a03ad2ffb9ull, // 5^-88
+        0xfea126b7d78186bcull, 0xe2f610c84987bfa8ull, // 5^-87
+        0x9f24b832e6b0f436ull, 0x0dd9ca7d2df4d7c9ull, // 5^-86
+        0xc6ede63fa05d3143ull, 0x91503d1c79720dbbull, // 5^-85
+        0xf8a95fcf88747d94ull, 0x75a44c6397ce912aull, // 5^-84
+        0x9b69dbe1b548ce7cull, 0xc986afbe3ee11abaull, // 5^-83
+        0xc24452da229b021bull, 0xfbe85badce996168ull, // 5^-82
+        0xf2d56790ab41c2a2ull, 0xfae27299423fb9c3ull, // 5^-81
+        0x97c560ba6b0919a5ull, 0xdccd879fc967d41aull, // 5^-80
+        0xbdb6b8e905cb600full, 0x5400e987bbc1c920ull, // 5^-79
+        0xed246723473e3813ull, 0x290123e9aab23b68ull, // 5^-78
+        0x9436c0760c86e30bull, 0xf9a0b6720aaf6521ull, // 5^-77
+        0xb94470938fa89bceull, 0xf808e40e8d5b3e69ull, // 5^-76
+        0xe7958cb87392c2c2ull, 0xb60b1d1230b20e04ull, // 5^-75
+        0x90bd77f3483bb9b9ull, 0xb1c6f22b5e6f48c2ull, // 5^-74
+        0xb4ecd5f01a4aa828ull, 0x1e38aeb6360b1af3ull, // 5^-73
+        0xe2280b6c20dd5232ull, 0x25c6da63c38de1b0ull, // 5^-72
+        0x8d590723948a535full, 0x579c487e5a38ad0eull, // 5^-71
+        0xb0af48ec79ace837ull, 0x2d835a9df0c6d851ull, // 5^-70
+        0xdcdb1b2798182244ull, 0xf8e431456cf88e65ull, // 5^-69
+        0x8a08f0f8bf0f156bull, 0x1b8e9ecb641b58ffull, // 5^-68
+        0xac8b2d36eed2dac5ull, 0xe272467e3d222f3full, // 5^-67
+        0xd7adf884aa879177ull, 0x5b0ed81dcc6abb0full, // 5^-66
+        0x86ccbb52ea94baeaull, 0x98e947129fc2b4e9ull, // 5^-65
+        0xa87fea27a539e9a5ull, 0x3f2398d747b36224ull, // 5^-64
+        0xd29fe4b18e88640eull, 0x8eec7f0d19a03aadull, // 5^-63
+        0x83a3eeeef9153e89ull, 0x1953cf68300424acull, // 5^-62
+        0xa48ceaaab75a8e2bull, 0x5fa8c3423c052dd7ull, // 5^-61
+        0xcdb02555653131b6ull, 0x3792f412cb06794dull, // 5^-60
+        0x808e17555f3ebf11ull, 0xe2bbd88bbee40bd0ull, // 5^-59
+        0xa0b19d2ab70e6ed6ull, 0x5b6aceaeae9d0ec4ull, // 5^-58
+        0xc8de047564d20a8bull, 0xf245825a5a445275ull, // 5^-57
+        0xfb158592be068d2eull, 0xeed6e2f0f0d56712ull, // 5^-56
+        0x9ced737bb6c4183dull, 0x55464dd69685606bull, // 5^-55
+        0xc428d05aa4751e4cull, 0xaa97e14c3c26b886ull, // 5^-54
+        0xf53304714d9265dfull, 0xd53dd99f4b3066a8ull, // 5^-53
+        0x993fe2c6d07b7fabull, 0xe546a8038efe4029ull, // 5^-52
+        0xbf8fdb78849a5f96ull, 0xde98520472bdd033ull, // 5^-51
+        0xef73d256a5c0f77cull, 0x963e66858f6d4440ull, // 5^-50
+        0x95a8637627989aadull, 0xdde7001379a44aa8ull, // 5^-49
+        0xbb127c53b17ec159ull, 0x5560c018580d5d52ull, // 5^-48
+        0xe9d71b689dde71afull, 0xaab8f01e6e10b4a6ull, // 5^-47
+        0x9226712162ab070dull, 0xcab3961304ca70e8ull, // 5^-46
+        0xb6b00d69bb55c8d1ull, 0x3d607b97c5fd0d22ull, // 5^-45
+        0xe45c10c42a2b3b05ull, 0x8cb89a7db77c506aull, // 5^-44
+        0x8eb98a7a9a5b04e3ull, 0x77f3608e92adb242ull, // 5^-43
+        0xb267ed1940f1c61cull, 0x55f038b237591ed3ull, // 5^-42
+        0xdf01e85f912e37a3ull, 0x6b6c46dec52f6688ull, // 5^-41
+        0x8b61313bbabce2c6ull, 0x2323ac4b3b3da015ull, // 5^-40
+        0xae397d8aa96c1b77ull, 0xabec975e0a0d081aull, // 5^-39
+        0xd9c7dced53c72255ull, 0x96e7bd358c904a21ull, // 5^-38
+        0x881cea14545c7575ull, 0x7e50d64177da2e54ull, // 5^-37
+        0xaa242499697392d2ull, 0xdde50bd1d5d0b9e9ull, // 5^-36
+        0xd4ad2dbfc3d07787ull, 0x955e4ec64b44e864ull, // 5^-35
+        0x84ec3c97da624ab4ull, 0xbd5af13bef0b113eull, // 5^-34
+        0xa6274bbdd0fadd61ull, 0xecb1ad8aeacdd58eull, // 5^-33
+        0xcfb11ead453994baull, 0x67de18eda5814af2ull, // 5^-32
+        0x81ceb32c4b43fcf4ull, 0x80eacf948770ced7ull, // 5^-31
+        0xa2425ff75e14fc31ull, 0xa1258379a94d028dull, // 5^-30
+        0xcad2f7f5359a3b3eull, 0x096ee45813a04330ull, // 5^-29
+        0xfd87b5f28300ca0dull, 0x8bca9d6e188853fcull, // 5^-28
+        0x9e74d1b791e07e48ull, 0x775ea264cf55347eull, // 5^-27
+        0xc612062576589ddaull, 0x95364afe032a819eull, // 5^-26
+        0xf79687aed3eec551ull, 0x3a83ddbd83f52205ull, // 5^-25
+        0x9abe14cd44753b52ull, 0xc4926a9672793543ull, // 5^-24
+        0xc16d9a0095928a27ull, 0x75b7053c0f178294ull, // 5^-23
+        0xf1c90080baf72cb1ull, 0x5324c68b12dd6339ull, // 5^-22
+        0x971da05074da7beeull, 0xd3f6fc16ebca5e04ull, // 5^-21
+        0xbce5086492111aeaull, 0x88f4bb1ca6bcf585ull, // 5^-20
+        0xec1e4a7db69561a5ull, 0x2b31e9e3d06c32e6ull, // 5^-19
+        0x9392ee8e921d5d07ull, 0x3aff322e62439fd0ull, // 5^-18
+        0xb877aa3236a4b449ull, 0x09befeb9fad487c3ull, // 5^-17
+        0xe69594bec44de15bull, 0x4c2ebe687989a9b4ull, // 5^-16
+        0x901d7cf73ab0acd9ull, 0x0f9d37014bf60a11ull, // 5^-15
+        0xb424dc35095cd80full, 0x538484c19ef38c95ull, // 5^-14
+        0xe12e13424bb40e13ull, 0x2865a5f206b06fbaull, // 5^-13
+        0x8cbccc096f5088cbull, 0xf93f87b7442e45d4ull, // 5^-12
+        0xafebff0bcb24aafeull, 0xf78f69a51539d749ull, // 5^-11
+        0xdbe6fecebdedd5beull, 0xb573440e5a884d1cull, // 5^-10
+        0x89705f4136b4a597ull, 0x31680a88f8953031ull, // 5^-9
+        0xabcc77118461cefcull, 0xfdc20d2b36ba7c3eull, // 5^-8
+        0xd6bf94d5e57a42bcull, 0x3d32907604691b4dull, // 5^-7
+        0x8637bd05af6c69b5ull, 0xa63f9a49c2c1b110ull, // 5^-6
+        0xa7c5ac471b478423ull, 0x0fcf80dc33721d54ull, // 5^-5
+        0xd1b71758e219652bull, 0xd3c36113404ea4a9ull, // 5^-4
+        0x83126e978d4fdf3bull, 0x645a1cac083126eaull, // 5^-3
+        0xa3d70a3d70a3d70aull, 0x3d70a3d70a3d70a4ull, // 5^-2
+        0xccccccccccccccccull, 0xcccccccccccccccdull, // 5^-1
+        0x8000000000000000ull, 0x0000000000000000ull, // 5^0
+        0xa000000000000000ull, 0x0000000000000000ull, // 5^1
+        0xc800000000000000ull, 0x0000000000000000ull, // 5^2
+        0xfa00000000000000ull, 0x0000000000000000ull, // 5^3
+        0x9c40000000000000ull, 0x0000000000000000ull, // 5^4
+        0xc350000000000000ull, 0x0000000000000000ull, // 5^5
+        0xf424000000000000ull, 0x0000000000000000ull, // 5^6
+        0x9896800000000000ull, 0x0000000000000000ull, // 5^7
+        0xbebc200000000000ull, 0x0000000000000000ull, // 5^8
+        0xee6b280000000000ull, 0x0000000000000000ull, // 5^9
+        0x9502f90000000000ull, 0x0000000000000000ull, // 5^10
+        0xba43b74000000000ull, 0x0000000000000000ull, // 5^11
+        0xe8d4a51000000000ull, 0x0000000000000000ull, // 5^12
+        0x9184e72a00000000ull, 0x0000000000000000ull, // 5^13
+        0xb5e620f480000000ull, 0x0000000000000000ull, // 5^14
+        0xe35fa931a0000000ull, 0x0000000000000000ull, // 5^15
+        0x8e1bc9bf04000000ull, 0x0000000000000000ull, // 5^16
+        0xb1a2bc2ec5000000ull, 0x0000000000000000ull, // 5^17
+        0xde0b6b3a76400000ull, 0x0000000000000000ull, // 5^18
+        0x8ac7230489e80000ull, 0x0000000000000000ull, // 5^19
+        0xad78ebc5ac620000ull, 0x0000000000000000ull, // 5^20
+        0xd8d726b7177a8000ull, 0x0000000000000000ull, // 5^21
+        0x878678326eac9000ull, 0x0000000000000000ull, // 5^22
+        0xa968163f0a57b400ull, 0x0000000000000000ull, // 5^23
+        0xd3c21bcecceda100ull, 0x0000000000000000ull, // 5^24
+        0x84595161401484a0ull, 0x0000000000000000ull, // 5^25
+        0xa56fa5b99019a5c8ull, 0x0000000000000000ull, // 5^26
+        0xcecb8f27f4200f3aull, 0x0000000000000000ull, // 5^27
+        0x813f3978f8940984ull, 0x4000000000000000ull, // 5^28
+        0xa18f07d736b90be5ull, 0x5000000000000000ull, // 5^29
+        0xc9f2c9cd04674edeull, 0xa400000000000000ull, // 5^30
+        0xfc6f7c4045812296ull, 0x4d00000000000000ull, // 5^31
+        0x9dc5ada82b70b59dull, 0xf020000000000000ull, // 5^32
+        0xc5371912364ce305ull, 0x6c28000000000000ull, // 5^33
+        0xf684df56c3e01bc6ull, 0xc732000000000000ull, // 5^34
+        0x9a130b963a6c115cull, 0x3c7f400000000000ull, // 5^35
+        0xc097ce7bc90715b3ull, 0x4b9f100000000000ull, // 5^36
+        0xf0bdc21abb48db20ull, 0x1e86d40000000000ull, // 5^37
+        0x96769950b50d88f4ull, 0x1314448000000000ull, // 5^38
+        0xbc143fa4e250eb31ull, 0x17d955a000000000ull, // 5^39
+        0xeb194f8e1ae525fdull, 0x5dcfab0800000000ull, // 5^40
+        0x92efd1b8d0cf37beull, 0x5aa1cae500000000ull, // 5^41
+        0xb7abc627050305adull, 0xf14a3d9e40000000ull, // 5^42
+        0xe596b7b0c643c719ull, 0x6d9ccd05d0000000ull, // 5^43
+        0x8f7e32ce7bea5c6full, 0xe4820023a2000000ull, // 5^44
+        0xb35dbf821ae4f38bull, 0xdda2802c8a800000ull, // 5^45
+        0xe0352f62a19e306eull, 0xd50b2037ad200000ull, // 5^46
+        0x8c213d9da502de45ull, 0x4526f422cc340000ull, // 5^47
+        0xaf298d050e4395d6ull, 0x9670b12b7f410000ull, // 5^48
+        0xdaf3f04651d47b4cull, 0x3c0cdd765f114000ull, // 5^49
+        0x88d8762bf324cd0full, 0xa5880a69fb6ac800ull, // 5^50
+        0xab0e93b6efee0053ull, 0x8eea0d047a457a00ull, // 5^51
+        0xd5d238a4abe98068ull, 0x72a4904598d6d880ull, // 5^52
+        0x85a36366eb71f041ull, 0x47a6da2b7f864750ull, // 5^53
+        0xa70c3c40a64e6c51ull, 0x999090b65f67d924ull, // 5^54
+        0xd0cf4b50cfe20765ull, 0xfff4b4e3f741cf6dull, // 5^55
+        0x82818f1281ed449full, 0xbff8f10e7a8921a4ull, // 5^56
+        0xa321f2d7226895c7ull, 0xaff72d52192b6a0dull, // 5^57
+        0xcbea6f8ceb02bb39ull, 0x9bf4f8a69f764490ull, // 5^58
+        0xfee50b7025c36a08ull, 0x02f236d04753d5b4ull, // 5^59
+        0x9f4f2726179a2245ull, 0x01d762422c946590ull, // 5^60
+        0xc722f0ef9d80aad6ull, 0x424d3ad2b7b97ef5ull, // 5^61
+        0xf8ebad2b84e0d58bull, 0xd2e0898765a7deb2ull, // 5^62
+        0x9b934c3b330c8577ull, 0x63cc55f49f88eb2full, // 5^63
+        0xc2781f49ffcfa6d5ull, 0x3cbf6b71c76b25fbull, // 5^64
+        0xf316271c7fc3908aull, 0x8bef464e3945ef7aull, // 5^65
+        0x97edd871cfda3a56ull, 0x97758bf0e3cbb5acull, // 5^66
+        0xbde94e8e43d0c8ecull, 0x3d52eeed1cbea317ull, // 5^67
+        0xed63a231d4c4fb27ull, 0x4ca7aaa863ee4bddull, // 5^68
+        0x945e455f24fb1cf8ull, 0x8fe8caa93e74ef6aull, // 5^69
+        0xb975d6b6ee39e436ull, 0xb3e2fd538e122b44ull, // 5^70
+        0xe7d34c64a9c85d44ull, 0x60dbbca87196b616ull, // 5^71
+        0x90e40fbeea1d3a4aull, 0xbc8955e946fe31cdull, // 5^72
+        0xb51d13aea4a488ddull, 0x6babab6398bdbe41ull, // 5^73
+        0xe264589a4dcdab14ull, 0xc696963c7eed2dd1ull, // 5^74
+        0x8d7eb76070a08aecull, 0xfc1e1de5cf543ca2ull, // 5^75
+        0xb0de65388cc8ada8ull, 0x3b25a55f43294bcbull, // 5^76
+        0xdd15fe86affad912ull, 0x49ef0eb713f39ebeull, // 5^77
+        0x8a2dbf142dfcc7abull, 0x6e3569326c784337ull, // 5^78
+        0xacb92ed9397bf996ull, 0x49c2c37f07965404ull, // 5^79
+        0xd7e77a8f87daf7fbull, 0xdc33745ec97be906ull, // 5^80
+        0x86f0ac99b4e8dafdull, 0x69a028bb3ded71a3ull, // 5^81
+        0xa8acd7c0222311bcull, 0xc40832ea0d68ce0cull, // 5^82
+        0xd2d80db02aabd62bull, 0xf50a3fa490c30190ull, // 5^83
+        0x83c7088e1aab65dbull, 0x792667c6da79e0faull, // 5^84
+        0xa4b8cab1a1563f52ull, 0x577001b891185938ull, // 5^85
+        0xcde6fd5e09abcf26ull, 0xed4c0226b55e6f86ull, // 5^86
+        0x80b05e5ac60b6178ull, 0x544f8158315b05b4ull, // 5^87
+        0xa0dc75f1778e39d6ull, 0x696361ae3db1c721ull, // 5^88
+        0xc913936dd571c84cull, 0x03bc3a19cd1e38e9ull, // 5^89
+        0xfb5878494ace3a5full, 0x04ab48a04065c723ull, // 5^90
+        0x9d174b2dcec0e47bull, 0x62eb0d64283f9c76ull, // 5^91
+        0xc45d1df942711d9aull, 0x3ba5d0bd324f8394ull, // 5^92
+        0xf5746577930d6500ull, 0xca8f44ec7ee36479ull, // 5^93
+        0x9968bf6abbe85f20ull, 0x7e998b13cf4e1ecbull, // 5^94
+        0xbfc2ef456ae276e8ull, 0x9e3fedd8c321a67eull, // 5^95
+        0xefb3ab16c59b14a2ull, 0xc5cfe94ef3ea101eull, // 5^96
+        0x95d04aee3b80ece5ull, 0xbba1f1d158724a12ull, // 5^97
+        0xbb445da9ca61281full, 0x2a8a6e45ae8edc97ull, // 5^98
+        0xea1575143cf97226ull, 0xf52d09d71a3293bdull, // 5^99
+        0x924d692ca61be758ull, 0x593c2626705f9c56ull, // 5^100
+        0xb6e0c377cfa2e12eull, 0x6f8b2fb00c77836cull, // 5^101
+        0xe498f455c38b997aull, 0x0b6dfb9c0f956447ull, // 5^102
+        0x8edf98b59a373fecull, 0x4724bd4189bd5eacull, // 5^103
+        0xb2977ee300c50fe7ull, 0x58edec91ec2cb657ull, // 5^104
+        0xdf3d5e9bc0f653e1ull, 0x2f2967b66737e3edull, // 5^105
+        0x8b865b215899f46cull, 0xbd79e0d20082ee74ull, // 5^106
+        0xae67f1e9aec07187ull, 0xecd8590680a3aa11ull, // 5^107
+        0xda01ee641a708de9ull, 0xe80e6f4820cc9495ull, // 5^108
+        0x884134fe908658b2ull, 0x3109058d147fdcddull, // 5^109
+        0xaa51823e34a7eedeull, 0xbd4b46f0599fd415ull, // 5^110
+        0xd4e5e2cdc1d1ea96ull, 0x6c9e18ac7007c91aull, // 5^111
+        0x850fadc09923329eull, 0x03e2cf6bc604ddb0ull, // 5^112
+        0xa6539930bf6bff45ull, 0x84db8346b786151cull, // 5^113
+        0xcfe87f7cef46ff16ull, 0xe612641865679a63ull, // 5^114
+        0x81f14fae158c5f6eull, 0x4fcb7e8f3f60c07eull, // 5^115
+        0xa26da3999aef7749ull, 0xe3be5e330f38f09dull, // 5^116
+        0xcb090c8001ab551cull, 0x5cadf5bfd3072cc5ull, // 5^117
+        0xfdcb4fa002162a63ull, 0x73d9732fc7c8f7f6ull, // 5^118
+        0x9e9f11c4014dda7eull, 0x2867e7fddcdd9afaull, // 5^119
+        0xc646d63501a1511dull, 0xb281e1fd541501b8ull, // 5^120
+        0xf7d88bc24209a565ull, 0x1f225a7ca91a4226ull, // 5^121
+        0x9ae757596946075full, 0x3375788de9b06958ull, // 5^122
+        0xc1a12d2fc3978937ull, 0x0052d6b1641c83aeull, // 5^123
+        0xf209787bb47d6b84ull, 0xc0678c5dbd23a49aull, // 5^124
+        0x9745eb4d50ce6332ull, 0xf840b7ba963646e0ull, // 5^125
+        0xbd176620a501fbffull, 0xb650e5a93bc3d898ull, // 5^126
+        0xec5d3fa8ce427affull, 0xa3e51f138ab4cebeull, // 5^127
+        0x93ba47c980e98cdfull, 0xc66f336c36b10137ull, // 5^128
+        0xb8a8d9bbe123f017ull, 0xb80b0047445d4184ull, // 5^129
+        0xe6d3102ad96cec1dull, 0xa60dc059157491e5ull, // 5^130
+        0x9043ea1ac7e41392ull, 0x87c89837ad68db2full, // 5^131
+        0xb454e4a179dd1877ull, 0x29babe4598c311fbull, // 5^132
+        0xe16a1dc9d8545e94ull, 0xf4296dd6fef3d67aull, // 5^133
+        0x8ce2529e2734bb1dull, 0x1899e4a65f58660cull, // 5^134
+        0xb01ae745b101e9e4ull, 0x5ec05dcff72e7f8full, // 5^135
+        0xdc21a1171d42645dull, 0x76707543f4fa1f73ull, // 5^136
+        0x899504ae72497ebaull, 0x6a06494a791c53a8ull, // 5^137
+        0xabfa45da0edbde69ull, 0x0487db9d17636892ull, // 5^138
+        0xd6f8d7509292d603ull, 0x45a9d2845d3c42b6ull, // 5^139
+        0x865b86925b9bc5c2ull, 0x0b8a2392ba45a9b2ull, // 5^140
+        0xa7f26836f282b732ull, 0x8e6cac7768d7141eull, // 5^141
+        0xd1ef0244af2364ffull, 0x3207d795430cd926ull, // 5^142
+        0x8335616aed761f1full, 0x7f44e6bd49e807b8ull, // 5^143
+        0xa402b9c5a8d3a6e7ull, 0x5f16206c9c6209a6ull, // 5^144
+        0xcd036837130890a1ull, 0x36dba887c37a8c0full, // 5^145
+        0x802221226be55a64ull, 0xc2494954da2c9789ull, // 5^146
+        0xa02aa96b06deb0fdull, 0xf2db9baa10b7bd6cull, // 5^147
+        0xc83553c5c8965d3dull, 0x6f92829494e5acc7ull, // 5^148
+        0xfa42a8b73abbf48cull, 0xcb772339ba1f17f9ull, // 5^149
+        0x9c69a97284b578d7ull, 0xff2a760414536efbull, // 5^150
+        0xc38413cf25e2d70dull, 0xfef5138519684abaull, // 5^151
+        0xf46518c2ef5b8cd1ull, 0x7eb258665fc25d69ull, // 5^152
+        0x98bf2f79d5993802ull, 0xef2f773ffbd97a61ull, // 5^153
+        0xbeeefb584aff8603ull, 0xaafb550ffacfd8faull, // 5^154
+        0xeeaaba2e5dbf6784ull, 0x95ba2a53f983cf38ull, // 5^155
+        0x952ab45cfa97a0b2ull, 0xdd945a747bf26183ull, // 5^156
+        0xba756174393d88dfull, 0x94f971119aeef9e4ull, // 5^157
+        0xe912b9d1478ceb17ull, 0x7a37cd5601aab85dull, // 5^158
+        0x91abb422ccb812eeull, 0xac62e055c10ab33aull, // 5^159
+        0xb616a12b7fe617aaull, 0x577b986b314d6009ull, // 5^160
+        0xe39c49765fdf9d94ull, 0xed5a7e85fda0b80bull, // 5^161
+        0x8e41ade9fbebc27dull, 0x14588f13be847307ull, // 5^162
+        0xb1d219647ae6b31cull, 0x596eb2d8ae258fc8ull, // 5^163
+        0xde469fbd99a05fe3ull, 0x6fca5f8ed9aef3bbull, // 5^164
+        0x8aec23d680043beeull, 0x25de7bb9480d5854ull, // 5^165
+        0xada72ccc20054ae9ull, 0xaf561aa79a10ae6aull, // 5^166
+        0xd910f7ff28069da4ull, 0x1b2ba1518094da04ull, // 5^167
+        0x87aa9aff79042286ull, 0x90fb44d2f05d0842ull, // 5^168
+        0xa99541bf57452b28ull, 0x353a1607ac744a53ull, // 5^169
+        0xd3fa922f2d1675f2ull, 0x42889b8997915ce8ull, // 5^170
+        0x847c9b5d7c2e09b7ull, 0x69956135febada11ull, // 5^171
+        0xa59bc234db398c25ull, 0x43fab9837e699095ull, // 5^172
+        0xcf02b2c21207ef2eull, 0x94f967e45e03f4bbull, // 5^173
+        0x8161afb94b44f57dull, 0x1d1be0eebac278f5ull, // 5^174
+        0xa1ba1ba79e1632dcull, 0x6462d92a69731732ull, // 5^175
+        0xca28a291859bbf93ull, 0x7d7b8f7503cfdcfeull, // 5^176
+        0xfcb2cb35e702af78ull, 0x5cda735244c3d43eull, // 5^177
+        0x9defbf01b061adabull, 0x3a0888136afa64a7ull, // 5^178
+        0xc56baec21c7a1916ull, 0x088aaa1845b8fdd0ull, // 5^179
+        0xf6c69a72a3989f5bull, 0x8aad549e57273d45ull, // 5^180
+        0x9a3c2087a63f6399ull, 0x36ac54e2f678864bull, // 5^181
+        0xc0cb28a98fcf3c7full, 0x84576a1bb416a7ddull, // 5^182
+        0xf0fdf2d3f3c30b9full, 0x656d44a2a11c51d5ull, // 5^183
+        0x969eb7c47859e743ull, 0x9f644ae5a4b1b325ull, // 5^184
+        0xbc4665b596706114ull, 0x873d5d9f0dde1feeull, // 5^185
+        0xeb57ff22fc0c7959ull, 0xa90cb506d155a7eaull, // 5^186
+        0x9316ff75dd87cbd8ull, 0x09a7f12442d588f2ull, // 5^187
+        0xb7dcbf5354e9beceull, 0x0c11ed6d538aeb2full, // 5^188
+        0xe5d3ef282a242e81ull, 0x8f1668c8a86da5faull, // 5^189
+        0x8fa475791a569d10ull, 0xf96e017d694487bcull, // 5^190
+        0xb38d92d760ec4455ull, 0x37c981dcc395a9acull, // 5^191
+        0xe070f78d3927556aull, 0x85bbe253f47b1417ull, // 5^192
+        0x8c469ab843b89562ull, 0x93956d7478ccec8eull, // 5^193
+        0xaf58416654a6babbull, 0x387ac8d1970027b2ull, // 5^194
+        0xdb2e51bfe9d0696aull, 0x06997b05fcc0319eull, // 5^195
+        0x88fcf317f22241e2ull, 0x441fece3bdf81f03ull, // 5^196
+        0xab3c2fddeeaad25aull, 0xd527e81cad7626c3ull, // 5^197
+        0xd60b3bd56a5586f1ull, 0x8a71e223d8d3b074ull, // 5^198
+        0x85c7056562757456ull, 0xf6872d5667844e49ull, // 5^199
+        0xa738c6bebb12d16cull, 0xb428f8ac016561dbull, // 5^200
+        0xd106f86e69d785c7ull, 0xe13336d701beba52ull, // 5^201
+        0x82a45b450226b39cull, 0xecc0024661173473ull, // 5^202
+        0xa34d721642b06084ull, 0x27f002d7f95d0190ull, // 5^203
+        0xcc20ce9bd35c78a5ull, 0x31ec038df7b441f4ull, // 5^204
+        0xff290242c83396ceull, 0x7e67047175a15271ull, // 5^205
+        0x9f79a169bd203e41ull, 0x0f0062c6e984d386ull, // 5^206
+        0xc75809c42c684dd1ull, 0x52c07b78a3e60868ull, // 5^207
+        0xf92e0c3537826145ull, 0xa7709a56ccdf8a82ull, // 5^208
+        0x9bbcc7a142b17ccbull, 0x88a66076400bb691ull, // 5^209
+        0xc2abf989935ddbfeull, 0x6acff893d00ea435ull, // 5^210
+        0xf356f7ebf83552feull, 0x0583f6b8c4124d43ull, // 5^211
+        0x98165af37b2153deull, 0xc3727a337a8b704aull, // 5^212
+        0xbe1bf1b059e9a8d6ull, 0x744f18c0592e4c5cull, // 5^213
+        0xeda2ee1c7064130cull, 0x1162def06f79df73ull, // 5^214
+        0x9485d4d1c63e8be7ull, 0x8addcb5645ac2ba8ull, // 5^215
+        0xb9a74a0637ce2ee1ull, 0x6d953e2bd7173692ull, // 5^216
+        0xe8111c87c5c1ba99ull, 0xc8fa8db6ccdd0437ull, // 5^217
+        0x910ab1d4db9914a0ull, 0x1d9c9892400a22a2ull, // 5^218
+        0xb54d5e4a127f59c8ull, 0x2503beb6d00cab4bull, // 5^219
+        0xe2a0b5dc971f303aull, 0x2e44ae64840fd61dull, // 5^220
+        0x8da471a9de737e24ull, 0x5ceaecfed289e5d2ull, // 5^221
+        0xb10d8e1456105dadull, 0x7425a83e872c5f47ull, // 5^222
+        0xdd50f1996b947518ull, 0xd12f124e28f77719ull, // 5^223
+        0x8a5296ffe33cc92full, 0x82bd6b70d99aaa6full, // 5^224
+        0xace73cbfdc0bfb7bull, 0x636cc64d1001550bull, // 5^225
+        0xd8210befd30efa5aull, 0x3c47f7e05401aa4eull, // 5^226
+        0x8714a775e3e95c78ull, 0x65acfaec34810a71ull, // 5^227
+        0xa8d9d1535ce3b396ull, 0x7f1839a741a14d0dull, // 5^228
+        0xd31045a8341ca07cull, 0x1ede48111209a050ull, // 5^229
+        0x83ea2b892091e44dull, 0x934aed0aab460432ull, // 5^230
+        0xa4e4b66b68b65d60ull, 0xf81da84d5617853full, // 5^231
+        0xce1de40642e3f4b9ull, 0x36251260ab9d668eull, // 5^232
+        0x80d2ae83e9ce78f3ull, 0xc1d72b7c6b426019ull, // 5^233
+        0xa1075a24e4421730ull, 0xb24cf65b8612f81full, // 5^234
+        0xc94930ae1d529cfcull, 0xdee033f26797b627ull, // 5^235
+        0xfb9b7cd9a4a7443cull, 0x169840ef017da3b1ull, // 5^236
+        0x9d412e0806e88aa5ull, 0x8e1f289560ee864eull, // 5^237
+        0xc491798a08a2ad4eull, 0xf1a6f2bab92a27e2ull, // 5^238
+        0xf5b5d7ec8acb58a2ull, 0xae10af696774b1dbull, // 5^239
+        0x9991a6f3d6bf1765ull, 0xacca6da1e0a8ef29ull, // 5^240
+        0xbff610b0cc6edd3full, 0x17fd090a58d32af3ull, // 5^241
+        0xeff394dcff8a948eull, 0xddfc4b4cef07f5b0ull, // 5^242
+        0x95f83d0a1fb69cd9ull, 0x4abdaf101564f98eull, // 5^243
+        0xbb764c4ca7a4440full, 0x9d6d1ad41abe37f1ull, // 5^244
+        0xea53df5fd18d5513ull, 0x84c86189216dc5edull, // 5^245
+        0x92746b9be2f8552cull, 0x32fd3cf5b4e49bb4ull, // 5^246
+        0xb7118682dbb66a77ull, 0x3fbc8c33221dc2a1ull, // 5^247
+        0xe4d5e82392a40515ull, 0x0fabaf3feaa5334aull, // 5^248
+        0x8f05b1163ba6832dull, 0x29cb4d87f2a7400eull, // 5^249
+        0xb2c71d5bca9023f8ull, 0x743e20e9ef511012ull, // 5^250
+        0xdf78e4b2bd342cf6ull, 0x914da9246b255416ull, // 5^251
+        0x8bab8eefb6409c1aull, 0x1ad089b6c2f7548eull, // 5^252
+        0xae9672aba3d0c320ull, 0xa184ac2473b529b1ull, // 5^253
+        0xda3c0f568cc4f3e8ull, 0xc9e5d72d90a2741eull, // 5^254
+        0x8865899617fb1871ull, 0x7e2fa67c7a658892ull, // 5^255
+        0xaa7eebfb9df9de8dull, 0xddbb901b98feeab7ull, // 5^256
+        0xd51ea6fa85785631ull, 0x552a74227f3ea565ull, // 5^257
+        0x8533285c936b35deull, 0xd53a88958f87275full, // 5^258
+        0xa67ff273b8460356ull, 0x8a892abaf368f137ull, // 5^259
+        0xd01fef10a657842cull, 0x2d2b7569b0432d85ull, // 5^260
+        0x8213f56a67f6b29bull, 0x9c3b29620e29fc73ull, // 5^261
+        0xa298f2c501f45f42ull, 0x8349f3ba91b47b8full, // 5^262
+        0xcb3f2f7642717713ull, 0x241c70a936219a73ull, // 5^263
+        0xfe0efb53d30dd4d7ull, 0xed238cd383aa0110ull, // 5^264
+        0x9ec95d1463e8a506ull, 0xf4363804324a40aaull, // 5^265
+        0xc67bb4597ce2ce48ull, 0xb143c6053edcd0d5ull, // 5^266
+        0xf81aa16fdc1b81daull, 0xdd94b7868e94050aull, // 5^267
+        0x9b10a4e5e9913128ull, 0xca7cf2b4191c8326ull, // 5^268
+        0xc1d4ce1f63f57d72ull, 0xfd1c2f611f63a3f0ull, // 5^269
+        0xf24a01a73cf2dccfull, 0xbc633b39673c8cecull, // 5^270
+        0x976e41088617ca01ull, 0xd5be0503e085d813ull, // 5^271
+        0xbd49d14aa79dbc82ull, 0x4b2d8644d8a74e18ull, // 5^272
+        0xec9c459d51852ba2ull, 0xddf8e7d60ed1219eull, // 5^273
+        0x93e1ab8252f33b45ull, 0xcabb90e5c942b503ull, // 5^274
+        0xb8da1662e7b00a17ull, 0x3d6a751f3b936243ull, // 5^275
+        0xe7109bfba19c0c9dull, 0x0cc512670a783ad4ull, // 5^276
+        0x906a617d450187e2ull, 0x27fb2b80668b24c5ull, // 5^277
+        0xb484f9dc9641e9daull, 0xb1f9f660802dedf6ull, // 5^278
+        0xe1a63853bbd26451ull, 0x5e7873f8a0396973ull, // 5^279
+        0x8d07e33455637eb2ull, 0xdb0b487b6423e1e8ull, // 5^280
+        0xb049dc016abc5e5full, 0x91ce1a9a3d2cda62ull, // 5^281
+        0xdc5c5301c56b75f7ull, 0x7641a140cc7810fbull, // 5^282
+        0x89b9b3e11b6329baull, 0xa9e904c87fcb0a9dull, // 5^283
+        0xac2820d9623bf429ull, 0x546345fa9fbdcd44ull, // 5^284
+        0xd732290fbacaf133ull, 0xa97c177947ad4095ull, // 5^285
+        0x867f59a9d4bed6c0ull, 0x49ed8eabcccc485dull, // 5^286
+        0xa81f301449ee8c70ull, 0x5c68f256bfff5a74ull, // 5^287
+        0xd226fc195c6a2f8cull, 0x73832eec6fff3111ull, // 5^288
+        0x83585d8fd9c25db7ull, 0xc831fd53c5ff7eabull, // 5^289
+        0xa42e74f3d032f525ull, 0xba3e7ca8b77f5e55ull, // 5^290
+        0xcd3a1230c43fb26full, 0x28ce1bd2e55f35ebull, // 5^291
+        0x80444b5e7aa7cf85ull, 0x7980d163cf5b81b3ull, // 5^292
+        0xa0555e361951c366ull, 0xd7e105bcc332621full, // 5^293
+        0xc86ab5c39fa63440ull, 0x8dd9472bf3fefaa7ull, // 5^294
+        0xfa856334878fc150ull, 0xb14f98f6f0feb951ull, // 5^295
+        0x9c935e00d4b9d8d2ull, 0x6ed1bf9a569f33d3ull, // 5^296
+        0xc3b8358109e84f07ull, 0x0a862f80ec4700c8ull, // 5^297
+        0xf4a642e14c6262c8ull, 0xcd27bb612758c0faull, // 5^298
+        0x98e7e9cccfbd7dbdull, 0x8038d51cb897789cull, // 5^299
+        0xbf21e44003acdd2cull, 0xe0470a63e6bd56c3ull, // 5^300
+        0xeeea5d5004981478ull, 0x1858ccfce06cac74ull, // 5^301
+        0x95527a5202df0ccbull, 0x0f37801e0c43ebc8ull, // 5^302
+        0xbaa718e68396cffdull, 0xd30560258f54e6baull, // 5^303
+        0xe950df20247c83fdull, 0x47c6b82ef32a2069ull, // 5^304
+        0x91d28b7416cdd27eull, 0x4cdc331d57fa5441ull, // 5^305
+        0xb6472e511c81471dull, 0xe0133fe4adf8e952ull, // 5^306
+        0xe3d8f9e563a198e5ull, 0x58180fddd97723a6ull, // 5^307
+        0x8e679c2f5e44ff8full, 0x570f09eaa7ea7648ull, // 5^308
+    };
+
+    const uint64_t* t = pow5 + 2 * (q + 342);
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+
+    // High 64 bits are enough, unless the 9 bits below the mantissa and
+    // its round bit are all 1s, and a carry from the low bits may matter
+    unsigned __int128 r = (unsigned __int128)w * t[0];
+    uint64_t hi = r >> 64;
+    uint64_t lo = r;
+    if ((hi & 0x1ff) == 0x1ff) {
+        uint64_t hi2 = ((unsigned __int128)w * t[1]) >> 64;
+        lo += hi2;
+        hi += lo < hi2;
+    }
+    // 5^q is exact, and so is the product, for -27 <= q <= 55
+    if (unlikely(lo == ~0ull) && (q < -27 || q > 55))
+        return -1;
+
+    // 54 bits, the mantissa and a round bit.
+    // Binary exponent is floor(q * log2(10)) + 63
+    int upper = hi >> 63;
+    uint64_t m = hi >> (upper + 9);
+    int32_t p2 = ((217706 * q) >> 16) + 63 + upper - lz + 1023;
+
+    // Subnormal. Shift out the missing exponent and round
+    if (p2 <= 0) {
+        if (-p2 + 1 >= 64)
+            return 0;
+        m >>= -p2 + 1;
+        m += m & 1;
+        m >>= 1;
+        // rounded up to the smallest normal
+        p2 = m < (1ull << 52) ? 0 : 1;
+        return ((uint64_t)p2 << 52) | m;
+    }
+
+    // Exactly half way, round to even. Only possible for -4 <= q <= 23
+    if (lo <= 1 && q >= -4 && q <= 23 && (m & 3) == 1 &&
+        (m << (upper + 9)) == hi)
+        m &= ~1ull;
+
+    m += m & 1;
+    m >>= 1;
+    if (m >= (2ull << 52)) {
+        m = 1ull << 52;
+        p2++;
+    }
+    m &= ~(1ull << 52);
+
+    if (p2 >= 0x7ff)
+        return 0x7ffull << 52;
+    return ((uint64_t)p2 << 52) | m;
+}
+
+// Parse double with strtod. For the rare cases _eisel_lemire can't tell
+inline double _atod_slow(const char* s, uint32_t len) {
+    char buf[512];
+    char* p = len < sizeof(buf) ? buf : (char*)malloc(len + 1);
+    memcpy(p, s, len);
+    p[len] = '\0';
+    double d = strtod(p, nullptr);
+    if (p != buf)
+        free(p);
+    return d;
+}
+
+// Parse double from string. Correctly rounded.
+// [+-] digits [. digits] [e|E [+-] digits], inf, infinity or nan.
+// Anything after the number is ignored, no number returns 0.
+// *** The rare fallback for more than 19 digits uses strtod, so the
+// *** C locale is assumed
 inline double atod(const char* s, uint32_t len) {
-    // Get int part
-    int ilen = pmemchr(s, len, '.');
+    static const CODE_SECTION uint32_t pow10[9] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    static const CODE_SECTION double scales[23] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    const char* p = s;
+    const char* end = s + len;
+    bool neg = len && *p == '-';
+    p += len && (*p == '-' || *p == '+');
+
+    // Mantissa into w, and its decimal exponent
+    uint64_t w;
+    int64_t q;
+    uint32_t ni;
+    uint32_t nf;
+    bool trunc = false;
+    const char* m = p;
+
+    // One word has the digits, and the dot, of most prices.
+    // Find the first non-digit. If it is the dot, the next one too
+    uint64_t x = cast<uint64_t>(p);
+    uint64_t nd = ~_bytesbetween(x, '0', '9') & 0x8080808080808080ull;
+    uint32_t avail = end - p;
+    uint32_t i = nd ? __builtin_ctzll(nd) / 8 : 8;
+    bool dot = i < avail && p[i] == '.';
+    nd &= nd - dot;
+    uint32_t e = nd ? __builtin_ctzll(nd) / 8 : 8;
+    e = e < avail ? e : avail;
+
+    if (likely(e < 8 || e == avail)) {
+        // Remove the dot. "12.5" --> "125"
+        uint64_t lo = _bytesmask(i);
+        uint64_t y = dot ? (x & lo) | ((x >> 8) & ~lo) : x;
+        ni = dot ? i : e;
+        nf = e - ni - dot;
+        w = _atou8w(y, ni + nf);
+        q = -(int64_t)nf;
+        p += e;
+    }
+    else if (dot && _atod_frac8(p + i + 1, end, nf)) {
+        // Int part in one word, and up to 8 decimals in the next
+        ni = i;
+        w = (uint64_t)_atou8w(x, ni) * pow10[nf] +
+            _atou8w(cast<uint64_t>(p + i + 1), nf);
+        q = -(int64_t)nf;
+        p += i + 1 + nf;
+    }
+    else {
+        // Up to 19 digits, leading zeros too, w is exact
+        w = 0;
+        p = _atod_digits(p, end, w);
+        const char* ie = p;
+        const char* f = p;
+        if (p < end && *p == '.') {
+            f = ++p;
+            p = _atod_digits(p, end, w);
+        }
+        ni = ie - m;
+        nf = p - f;
+        q = -(int64_t)nf;
+
+        // More digits. Again, with only the first 19 significant ones in w
+        if (unlikely(ni + nf > 19)) {
+            uint32_t nd = 0;
+            uint32_t dropped = 0;
+            w = 0;
+            _atod_digits(m, ie, w, nd, dropped, trunc);
+            q = dropped;
+            dropped = 0;
+            _atod_digits(f, p, w, nd, dropped, trunc);
+            q -= nf - dropped;
+        }
+    }
+
+    // No digits. Maybe inf or nan
+    if (unlikely(ni + nf == 0)) {
+        uint64_t x = cast<uint64_t>(m) | 0x2020202020202020ull;
+        uint32_t left = end - m;
+        if (left >= 3 && (x & 0xffffff) == (cast<uint32_t>("inf") & 0xffffff))
+            return neg ? -__builtin_inf() : __builtin_inf();
+        if (left >= 3 && (x & 0xffffff) == (cast<uint32_t>("nan") & 0xffffff))
+            return neg ? -__builtin_nan("") : __builtin_nan("");
+        return 0;
+    }
+
+    // Exponent. An 'e' without digits is not part of the number
+    if (p + 1 < end && (*p | 0x20) == 'e') {
+        const char* e = p + 1;
+        bool eneg = *e == '-';
+        e += *e == '-' || *e == '+';
+        uint64_t x = 0;
+        const char* ee = parse_uint(e, end, x);
+        if (ee != e) {
+            // Saturate on the value, so leading zeros do not count. Anything
+            // past 10^9 is out of range anyway
+            x = x < 1000000000 ? x : 1000000000;
+            q += eneg ? -(int64_t)x : (int64_t)x;
+        }
+    }
+
+    double d;
+    if (w == 0) {
+        d = 0;
+    }
+    // Exact w, and exact 10^q. The one rounding is correct
+    else if (likely(!trunc && q >= -22 && q <= 22 && w <= (1ull << 53))) {
+        // int64_t converts faster
+        d = (int64_t)w;
+        d = q < 0 ? d / scales[-q] : d * scales[q];
+    }
+    else if (q < -342) {
+        d = 0;
+    }
+    else if (q > 308) {
+        d = __builtin_inf();
+    }
+    else {
+        // With digits dropped, the value is between w and w + 1
+        int64_t bits = _eisel_lemire(w, q);
+        if (unlikely(bits < 0 || (trunc && bits != _eisel_lemire(w + 1, q))))
+            return _atod_slow(s, len);
+        memcpy(&d, &bits, sizeof(d));
+    }
+    return neg ? -d : d;
+}
+
+//// String to fixed point
+
+// Parse decimal string to int64_t ticks of 10^-Scale, without double.
+// "123.4567" --> 1234567 at Scale 4. Optional '-' or '+'.
+// Decimals past Scale are rounded half away from zero.
+// *** More than 20 char integer part returns junk, like atou
+template <int Scale>
+inline int64_t atofixed(const char* s, uint32_t len) {
+    static_assert(Scale >= 0 && Scale <= 18);
+    static const CODE_SECTION uint64_t pow10[19] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+        10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+        100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+        100000000000000000ull, 1000000000000000000ull };
+
+    bool neg = !!len & (*s == '-');
+    bool ls = !!len & (*s == '-' || *s == '+');
+    s += ls;
+    len -= ls;
+
+    // Split at the dot, like atod
+    uint32_t ilen = pmemchr(s, len, '.');
+    uint32_t flen = ilen == (uint32_t)-1 ? 0 : len - ilen - 1;
+    ilen = ilen == (uint32_t)-1 ? len : ilen;
+    const char* f = flen ? s + ilen + 1 : s; // no word reads past the end
+
+    // Up to Scale decimals, padded to Scale with one multiply
+    uint32_t fl = flen < Scale ? flen : Scale;
+    uint64_t x = atou(s, ilen) * pow10[Scale] + atou(f, fl) * pow10[Scale - fl];
+
+    // Round on the first decimal past Scale
+    x += flen > Scale && f[Scale] >= '5';
+
+    return neg ? -x : x;
+}
+
+// Parse decimal string to int64_t ticks of 10^-Scale, or fail.
+// Like atofixed, but decimals past Scale must be '0', or it is
+// parse_inexact
+template <int Scale>
+inline parse_error atofixed_checked(const char* s, uint32_t len, int64_t& out) {
+    static_assert(Scale >= 0 && Scale <= 18);
+    static const CODE_SECTION uint64_t pow10[19] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+        10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+        100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+        100000000000000000ull, 1000000000000000000ull };
+
+    bool neg = !!len & (*s == '-');
+    bool ls = !!len & (*s == '-' || *s == '+');
+    s += ls;
+    len -= ls;
+
+    uint32_t ilen = pmemchr(s, len, '.');
+    uint32_t flen = ilen == (uint32_t)-1 ? 0 : len - ilen - 1;
+    ilen = ilen == (uint32_t)-1 ? len : ilen;
+    const char* f = flen ? s + ilen + 1 : s; // no word reads past the end
+
+    // "", "." and "-." have no digits. "5." and ".5" are fine
+    if (unlikely(ilen + flen == 0))
+        return parse_invalid;
+
+    uint64_t ipart = 0;
+    uint64_t fpart = 0;
+    parse_error err = ilen ? atou_checked(s, ilen, ipart) : parse_ok;
+    uint32_t fl = flen < Scale ? flen : Scale;
+    if (!err && fl)
+        err = atou_checked(f, fl, fpart);
+    if (unlikely(err))
+        return err;
+
+    // Decimals past Scale. Not digits first, then not '0'
+    uint64_t bad = 0;
+    uint64_t extra = 0;
+    for (uint32_t i = fl; i < flen; i += 8) {
+        uint32_t n = flen - i < 8 ? flen - i : 8;
+        extra |= _atou8c(f + i, n, bad);
+    }
+    if (unlikely(bad))
+        return parse_invalid;
+    if (unlikely(extra))
+        return parse_inexact;
+
+    // Up to 2^63 if negative, 2^63 - 1 if not
+    uint64_t x;
+    bool of = __builtin_mul_overflow(ipart, pow10[Scale], &x);
+    of |= __builtin_add_overflow(x, fpart * pow10[Scale - fl], &x);
+    if (unlikely(of || x > (1ull << 63) - !neg))
+        return parse_overflow;
+
+    out = neg ? -x : x;
+    return parse_ok;
+}
+
+//// Fixed point to string
+
+// Convert int64_t ticks of 10^-Scale to string, like "-123.4500" at
+// Scale 4. Exactly Scale decimals, or without trailing zeros if Trim, and
+// without the dot if there are none left. 1 <= Scale <= 8.
+// Buffer is at least 32 bytes, written in whole words. Returns length
+template <int Scale, bool Trim>
+inline uint32_t fixedtoa(int64_t ticks, char* buf) {
+    static_assert(Scale >= 1 && Scale <= 8);
+    uint64_t scale = 1;
+    for (int i = 0; i < Scale; i++)
+        scale *= 10;
+
+    // Handle negatives here, the int part may be 0
+    bool neg = ticks < 0;
+    uint64_t x = neg ? 0 - (uint64_t)ticks : ticks;
+    *buf = '-'; // Always write
+    buf += neg; // But advance only if negative
 
-    // If no decimal dot, return the int
-    if (ilen == -1) {
-        return atoi(s, len);
+    uint32_t n = itoa(x / scale, buf);
+    char* p = buf + n;
+    *p = '.';
+    _utoap<Scale>(x % scale, p + 1);
+    uint32_t len = n + 1 + Scale;
+
+    if constexpr (Trim) {
+        // Last decimal that is not '0'
+        uint64_t w = (cast<uint64_t>(p + 1) ^ 0x3030303030303030ull) & _bytesmask(Scale);
+        uint32_t keep = w ? (63 - __builtin_clzll(w)) / 8 + 1 : 0;
+        len = n + keep + (keep > 0);
     }
 
-    // Do the int part
-    int64_t ipart = atoi(s, ilen);
-    s += ilen + 1;
-    len -= ilen + 1;
+    buf[len] = '\0';
+    return len + neg;
+}
+
+//// Double to string
+
+// Shortest decimal f * 10^k that parses back to the double of bits.
+// Finite and not 0. Schubfach, like in Giulietti, The Schubfach way to
+// render doubles
+inline void _schubfach(uint64_t bits, uint64_t& f, int32_t& k) {
+    // 10^e, normalized to 128 bits, plus 1. For -292 <= e <= 324
+    // Array of 617 * 16 = 9872 bytes
+    static const CODE_SECTION uint64_t pow10[617 * 2] = {
+        0xff77b1fcbebcdc4full, 0x25e8e89c13bb0f7bull, // 10^-292
+        0x9faacf3df73609b1ull, 0x77b191618c54e9adull, // 10^-291
+        0xc795830d75038c1dull, 0xd59df5b9ef6a2418ull, // 10^-290
+        0xf97ae3d0d2446f25ull, 0x4b0573286b44ad1eull, // 10^-289
+        0x9becce62836ac577ull, 0x4ee367f9430aec33ull, // 10^-288
+        0xc2e801fb244576d5ull, 0x229c41f793cda740ull, // 10^-287
+        0xf3a20279ed56d48aull, 0x6b43527578c11110ull, // 10^-286
+        0x9845418c345644d6ull, 0x830a13896b78aaaaull, // 10^-285
+        0xbe5691ef416bd60cull, 0x23cc986bc656d554ull, // 10^-284
+        0xedec366b11c6cb8full, 0x2cbfbe86b7ec8aa9ull, // 10^-283
+        0x94b3a202eb1c3f39ull, 0x7bf7d71432f3d6aaull, // 10^-282
+        0xb9e08a83a5e34f07ull, 0xdaf5ccd93fb0cc54ull, // 10^-281
+        0xe858ad248f5c22c9ull, 0xd1b3400f8f9cff69ull, // 10^-280
+        0x91376c36d99995beull, 0x23100809b9c21fa2ull, // 10^-279
+        0xb58547448ffffb2dull, 0xabd40a0c2832a78bull, // 10^-278
+        0xe2e69915b3fff9f9ull, 0x16c90c8f323f516dull, // 10^-277
+        0x8dd01fad907ffc3bull, 0xae3da7d97f6792e4ull, // 10^-276
+        0xb1442798f49ffb4aull, 0x99cd11cfdf41779dull, // 10^-275
+        0xdd95317f31c7fa1dull, 0x40405643d711d584ull, // 10^-274
+        0x8a7d3eef7f1cfc52ull, 0x482835ea666b2573ull, // 10^-273
+        0xad1c8eab5ee43b66ull, 0xda3243650005eed0ull, // 10^-272
+        0xd863b256369d4a40ull, 0x90bed43e40076a83ull, // 10^-271
+        0x873e4f75e2224e68ull, 0x5a7744a6e804a292ull, // 10^-270
+        0xa90de3535aaae202ull, 0x711515d0a205cb37ull, // 10^-269
+        0xd3515c2831559a83ull, 0x0d5a5b44ca873e04ull, // 10^-268
+        0x8412d9991ed58091ull, 0xe858790afe9486c3ull, // 10^-267
+        0xa5178fff668ae0b6ull, 0x626e974dbe39a873ull, // 10^-266
+        0xce5d73ff402d98e3ull, 0xfb0a3d212dc81290ull, // 10^-265
+        0x80fa687f881c7f8eull, 0x7ce66634bc9d0b9aull, // 10^-264
+        0xa139029f6a239f72ull, 0x1c1fffc1ebc44e81ull, // 10^-263
+        0xc987434744ac874eull, 0xa327ffb266b56221ull, // 10^-262
+        0xfbe9141915d7a922ull, 0x4bf1ff9f0062baa9ull, // 10^-261
+        0x9d71ac8fada6c9b5ull, 0x6f773fc3603db4aaull, // 10^-260
+        0xc4ce17b399107c22ull, 0xcb550fb4384d21d4ull, // 10^-259
+        0xf6019da07f549b2bull, 0x7e2a53a146606a49ull, // 10^-258
+        0x99c102844f94e0fbull, 0x2eda7444cbfc426eull, // 10^-257
+        0xc0314325637a1939ull, 0xfa911155fefb5309ull, // 10^-256
+        0xf03d93eebc589f88ull, 0x793555ab7eba27cbull, // 10^-255
+        0x96267c7535b763b5ull, 0x4bc1558b2f3458dfull, // 10^-254
+        0xbbb01b9283253ca2ull, 0x9eb1aaedfb016f17ull, // 10^-253
+        0xea9c227723ee8bcbull, 0x465e15a979c1caddull, // 10^-252
+        0x92a1958a7675175full, 0x0bfacd89ec191ecaull, // 10^-251
+        0xb749faed14125d36ull, 0xcef980ec671f667cull, // 10^-250
+        0xe51c79a85916f484ull, 0x82b7e12780e7401bull, // 10^-249
+        0x8f31cc0937ae58d2ull, 0xd1b2ecb8b0908811ull, // 10^-248
+        0xb2fe3f0b8599ef07ull, 0x861fa7e6dcb4aa16ull, // 10^-247
+        0xdfbdcece67006ac9ull, 0x67a791e093e1d49bull, // 10^-246
+        0x8bd6a141006042bdull, 0xe0c8bb2c5c6d24e1ull, // 10^-245
+        0xaecc49914078536dull, 0x58fae9f773886e19ull, // 10^-244
+        0xda7f5bf590966848ull, 0xaf39a475506a899full, // 10^-243
+        0x888f99797a5e012dull, 0x6d8406c952429604ull, // 10^-242
+        0xaab37fd7d8f58178ull, 0xc8e5087ba6d33b84ull, // 10^-241
+        0xd5605fcdcf32e1d6ull, 0xfb1e4a9a90880a65ull, // 10^-240
+        0x855c3be0a17fcd26ull, 0x5cf2eea09a550680ull, // 10^-239
+        0xa6b34ad8c9dfc06full, 0xf42faa48c0ea481full, // 10^-238
+        0xd0601d8efc57b08bull, 0xf13b94daf124da27ull, // 10^-237
+        0x823c12795db6ce57ull, 0x76c53d08d6b70859ull, // 10^-236
+        0xa2cb1717b52481edull, 0x54768c4b0c64ca6full, // 10^-235
+        0xcb7ddcdda26da268ull, 0xa9942f5dcf7dfd0aull, // 10^-234
+        0xfe5d54150b090b02ull, 0xd3f93b35435d7c4dull, // 10^-233
+        0x9efa548d26e5a6e1ull, 0xc47bc5014a1a6db0ull, // 10^-232
+        0xc6b8e9b0709f109aull, 0x359ab6419ca1091cull, // 10^-231
+        0xf867241c8cc6d4c0ull, 0xc30163d203c94b63ull, // 10^-230
+        0x9b407691d7fc44f8ull, 0x79e0de63425dcf1eull, // 10^-229
+        0xc21094364dfb5636ull, 0x985915fc12f542e5ull, // 10^-228
+        0xf294b943e17a2bc4ull, 0x3e6f5b7b17b2939eull, // 10^-227
+        0x979cf3ca6cec5b5aull, 0xa705992ceecf9c43ull, // 10^-226
+        0xbd8430bd08277231ull, 0x50c6ff782a838354ull, // 10^-225
+        0xece53cec4a314ebdull, 0xa4f8bf5635246429ull, // 10^-224
+        0x940f4613ae5ed136ull, 0x871b7795e136be9aull, // 10^-223
+        0xb913179899f68584ull, 0x28e2557b59846e40ull, // 10^-222
+        0xe757dd7ec07426e5ull, 0x331aeada2fe589d0ull, // 10^-221
+        0x9096ea6f3848984full, 0x3ff0d2c85def7622ull, // 10^-220
+        0xb4bca50b065abe63ull, 0x0fed077a756b53aaull, // 10^-219
+        0xe1ebce4dc7f16dfbull, 0xd3e8495912c62895ull, // 10^-218
+        0x8d3360f09cf6e4bdull, 0x64712dd7abbbd95dull, // 10^-217
+        0xb080392cc4349decull, 0xbd8d794d96aacfb4ull, // 10^-216
+        0xdca04777f541c567ull, 0xecf0d7a0fc5583a1ull, // 10^-215
+        0x89e42caaf9491b60ull, 0xf41686c49db57245ull, // 10^-214
+        0xac5d37d5b79b6239ull, 0x311c2875c522ced6ull, // 10^-213
+        0xd77485cb25823ac7ull, 0x7d633293366b828cull, // 10^-212
+        0x86a8d39ef77164bcull, 0xae5dff9c02033198ull, // 10^-211
+        0xa8530886b54dbdebull, 0xd9f57f830283fdfdull, // 10^-210
+        0xd267caa862a12d66ull, 0xd072df63c324fd7cull, // 10^-209
+        0x8380dea93da4bc60ull, 0x4247cb9e59f71e6eull, // 10^-208
+        0xa46116538d0deb78ull, 0x52d9be85f074e609ull, // 10^-207
+        0xcd795be870516656ull, 0x67902e276c921f8cull, // 10^-206
+        0x806bd9714632dff6ull, 0x00ba1cd8a3db53b7ull, // 10^-205
+        0xa086cfcd97bf97f3ull, 0x80e8a40eccd228a5ull, // 10^-204
+        0xc8a883c0fdaf7df0ull, 0x6122cd128006b2ceull, // 10^-203
+        0xfad2a4b13d1b5d6cull, 0x796b805720085f82ull, // 10^-202
+        0x9cc3a6eec6311a63ull, 0xcbe3303674053bb1ull, // 10^-201
+        0xc3f490aa77bd60fcull, 0xbedbfc4411068a9dull, // 10^-200
+        0xf4f1b4d515acb93bull, 0xee92fb5515482d45ull, // 10^-199
+        0x991711052d8bf3c5ull, 0x751bdd152d4d1c4bull, // 10^-198
+        0xbf5cd54678eef0b6ull, 0xd262d45a78a0635eull, // 10^-197
+        0xef340a98172aace4ull, 0x86fb897116c87c35ull, // 10^-196
+        0x9580869f0e7aac0eull, 0xd45d35e6ae3d4da1ull, // 10^-195
+        0xbae0a846d2195712ull, 0x8974836059cca10aull, // 10^-194
+        0xe998d258869facd7ull, 0x2bd1a438703fc94cull, // 10^-193
+        0x91ff83775423cc06ull, 0x7b6306a34627ddd0ull, // 10^-192
+        0xb67f6455292cbf08ull, 0x1a3bc84c17b1d543ull, // 10^-191
+        0xe41f3d6a7377eecaull, 0x20caba5f1d9e4a94ull, // 10^-190
+        0x8e938662882af53eull, 0x547eb47b7282ee9dull, // 10^-189
+        0xb23867fb2a35b28dull, 0xe99e619a4f23aa44ull, // 10^-188
+        0xdec681f9f4c31f31ull, 0x6405fa00e2ec94d5ull, // 10^-187
+        0x8b3c113c38f9f37eull, 0xde83bc408dd3dd05ull, // 10^-186
+        0xae0b158b4738705eull, 0x9624ab50b148d446ull, // 10^-185
+        0xd98ddaee19068c76ull, 0x3badd624dd9b0958ull, // 10^-184
+        0x87f8a8d4cfa417c9ull, 0xe54ca5d70a80e5d7ull, // 10^-183
+        0xa9f6d30a038d1dbcull, 0x5e9fcf4ccd211f4dull, // 10^-182
+        0xd47487cc8470652bull, 0x7647c32000696720ull, // 10^-181
+        0x84c8d4dfd2c63f3bull, 0x29ecd9f40041e074ull, // 10^-180
+        0xa5fb0a17c777cf09ull, 0xf468107100525891ull, // 10^-179
+        0xcf79cc9db955c2ccull, 0x7182148d4066eeb5ull, // 10^-178
+        0x81ac1fe293d599bfull, 0xc6f14cd848405531ull, // 10^-177
+        0xa21727db38cb002full, 0xb8ada00e5a506a7dull, // 10^-176
+        0xca9cf1d206fdc03bull, 0xa6d90811f0e4851dull, // 10^-175
+        0xfd442e4688bd304aull, 0x908f4a166d1da664ull, // 10^-174
+        0x9e4a9cec15763e2eull, 0x9a598e4e043287ffull, // 10^-173
+        0xc5dd44271ad3cdbaull, 0x40eff1e1853f29feull, // 10^-172
+        0xf7549530e188c128ull, 0xd12bee59e68ef47dull, // 10^-171
+        0x9a94dd3e8cf578b9ull, 0x82bb74f8301958cfull, // 10^-170
+        0xc13a148e3032d6e7ull, 0xe36a52363c1faf02ull, // 10^-169
+        0xf18899b1bc3f8ca1ull, 0xdc44e6c3cb279ac2ull, // 10^-168
+        0x96f5600f15a7b7e5ull, 0x29ab103a5ef8c0baull, // 10^-167
+        0xbcb2b812db11a5deull, 0x7415d448f6b6f0e8ull, // 10^-166
+        0xebdf661791d60f56ull, 0x111b495b3464ad22ull, // 10^-165
+        0x936b9fcebb25c995ull, 0xcab10dd900beec35ull, // 10^-164
+        0xb84687c269ef3bfbull, 0x3d5d514f40eea743ull, // 10^-163
+        0xe65829b3046b0afaull, 0x0cb4a5a3112a5113ull, // 10^-162
+        0x8ff71a0fe2c2e6dcull, 0x47f0e785eaba72acull, // 10^-161
+        0xb3f4e093db73a093ull, 0x59ed216765690f57ull, // 10^-160
+        0xe0f218b8d25088b8ull, 0x306869c13ec3532dull, // 10^-159
+        0x8c974f7383725573ull, 0x1e414218c73a13fcull, // 10^-158
+        0xafbd2350644eeacfull, 0xe5d1929ef90898fbull, // 10^-157
+        0xdbac6c247d62a583ull, 0xdf45f746b74abf3aull, // 10^-156
+        0x894bc396ce5da772ull, 0x6b8bba8c328eb784ull, // 10^-155
+        0xab9eb47c81f5114full, 0x066ea92f3f326565ull, // 10^-154
+        0xd686619ba27255a2ull, 0xc80a537b0efefebeull, // 10^-153
+        0x8613fd0145877585ull, 0xbd06742ce95f5f37ull, // 10^-152
+        0xa798fc4196e952e7ull, 0x2c48113823b73705ull, // 10^-151
+        0xd17f3b51fca3a7a0ull, 0xf75a15862ca504c6ull, // 10^-150
+        0x82ef85133de648c4ull, 0x9a984d73dbe722fcull, // 10^-149
+        0xa3ab66580d5fdaf5ull, 0xc13e60d0d2e0ebbbull, // 10^-148
+        0xcc963fee10b7d1b3ull, 0x318df905079926a9ull, // 10^-147
+        0xffbbcfe994e5c61full, 0xfdf17746497f7053ull, // 10^-146
+        0x9fd561f1fd0f9bd3ull, 0xfeb6ea8bedefa634ull, // 10^-145
+        0xc7caba6e7c5382c8ull, 0xfe64a52ee96b8fc1ull, // 10^-144
+        0xf9bd690a1b68637bull, 0x3dfdce7aa3c673b1ull, // 10^-143
+        0x9c1661a651213e2dull, 0x06bea10ca65c084full, // 10^-142
+        0xc31bfa0fe5698db8ull, 0x486e494fcff30a63ull, // 10^-141
+        0xf3e2f893dec3f126ull, 0x5a89dba3c3efccfbull, // 10^-140
+        0x986ddb5c6b3a76b7ull, 0xf89629465a75e01dull, // 10^-139
+        0xbe89523386091465ull, 0xf6bbb397f1135824ull, // 10^-138
+        0xee2ba6c0678b597full, 0x746aa07ded582e2dull, // 10^-137
+        0x94db483840b717efull, 0xa8c2a44eb4571cddull, // 10^-136
+        0xba121a4650e4ddebull, 0x92f34d62616ce414ull, // 10^-135
+        0xe896a0d7e51e1566ull, 0x77b020baf9c81d18ull, // 10^-134
+        0x915e2486ef32cd60ull, 0x0ace1474dc1d122full, // 10^-133
+        0xb5b5ada8aaff80b8ull, 0x0d819992132456bbull, // 10^-132
+        0xe3231912d5bf60e6ull, 0x10e1fff697ed6c6aull, // 10^-131
+        0x8df5efabc5979c8full, 0xca8d3ffa1ef463c2ull, // 10^-130
+        0xb1736b96b6fd83b3ull, 0xbd308ff8a6b17cb3ull, // 10^-129
+        0xddd0467c64bce4a0ull, 0xac7cb3f6d05ddbdfull, // 10^-128
+        0x8aa22c0dbef60ee4ull, 0x6bcdf07a423aa96cull, // 10^-127
+        0xad4ab7112eb3929dull, 0x86c16c98d2c953c7ull, // 10^-126
+        0xd89d64d57a607744ull, 0xe871c7bf077ba8b8ull, // 10^-125
+        0x87625f056c7c4a8bull, 0x11471cd764ad4973ull, // 10^-124
+        0xa93af6c6c79b5d2dull, 0xd598e40d3dd89bd0ull, // 10^-123
+        0xd389b47879823479ull, 0x4aff1d108d4ec2c4ull, // 10^-122
+        0x843610cb4bf160cbull, 0xcedf722a585139bbull, // 10^-121
+        0xa54394fe1eedb8feull, 0xc2974eb4ee658829ull, // 10^-120
+        0xce947a3da6a9273eull, 0x733d226229feea33ull, // 10^-119
+        0x811ccc668829b887ull, 0x0806357d5a3f5260ull, // 10^-118
+        0xa163ff802a3426a8ull, 0xca07c2dcb0cf26f8ull, // 10^-117
+        0xc9bcff6034c13052ull, 0xfc89b393dd02f0b6ull, // 10^-116
+        0xfc2c3f3841f17c67ull, 0xbbac2078d443ace3ull, // 10^-115
+        0x9d9ba7832936edc0ull, 0xd54b944b84aa4c0eull, // 10^-114
+        0xc5029163f384a931ull, 0x0a9e795e65d4df12ull, // 10^-113
+        0xf64335bcf065d37dull, 0x4d4617b5ff4a16d6ull, // 10^-112
+        0x99ea0196163fa42eull, 0x504bced1bf8e4e46ull, // 10^-111
+        0xc06481fb9bcf8d39ull, 0xe45ec2862f71e1d7ull, // 10^-110
+        0xf07da27a82c37088ull, 0x5d767327bb4e5a4dull, // 10^-109
+        0x964e858c91ba2655ull, 0x3a6a07f8d510f870ull, // 10^-108
+        0xbbe226efb628afeaull, 0x890489f70a55368cull, // 10^-107
+        0xeadab0aba3b2dbe5ull, 0x2b45ac74ccea842full, // 10^-106
+        0x92c8ae6b464fc96full, 0x3b0b8bc90012929eull, // 10^-105
+        0xb77ada0617e3bbcbull, 0x09ce6ebb40173745ull, // 10^-104
+        0xe55990879ddcaabdull, 0xcc420a6a101d0516ull, // 10^-103
+        0x8f57fa54c2a9eab6ull, 0x9fa946824a12232eull, // 10^-102
+        0xb32df8e9f3546564ull, 0x47939822dc96abfaull, // 10^-101
+        0xdff9772470297ebdull, 0x59787e2b93bc56f8ull, // 10^-100
+        0x8bfbea76c619ef36ull, 0x57eb4edb3c55b65bull, // 10^-99
+        0xaefae51477a06b03ull, 0xede622920b6b23f2ull, // 10^-98
+        0xdab99e59958885c4ull, 0xe95fab368e45eceeull, // 10^-97
+        0x88b402f7fd75539bull, 0x11dbcb0218ebb415ull, // 10^-96
+        0xaae103b5fcd2a881ull, 0xd652bdc29f26a11aull, // 10^-95
+        0xd59944a37c0752a2ull, 0x4be76d3346f04960ull, // 10^-94
+        0x857fcae62d8493a5ull, 0x6f70a4400c562ddcull, // 10^-93
+        0xa6dfbd9fb8e5b88eull, 0xcb4ccd500f6bb953ull, // 10^-92
+        0xd097ad07a71f26b2ull, 0x7e2000a41346a7a8ull, // 10^-91
+        0x825ecc24c873782full, 0x8ed400668c0c28c9ull, // 10^-90
+        0xa2f67f2dfa90563bull, 0x728900802f0f32fbull, // 10^-89
+        0xcbb41ef979346bcaull, 0x4f2b40a03ad2ffbaull, // 10^-88
+        0xfea126b7d78186bcull, 0xe2f610c84987bfa9ull, // 10^-87
+        0x9f24b832e6b0f436ull, 0x0dd9ca7d2df4d7caull, // 10^-86
+        0xc6ede63fa05d3143ull, 0x91503d1c79720dbcull, // 10^-85
+        0xf8a95fcf88747d94ull, 0x75a44c6397ce912bull, // 10^-84
+        0x9b69dbe1b548ce7cull, 0xc986afbe3ee11abbull, // 10^-83
+        0xc24452da229b021bull, 0xfbe85badce996169ull, // 10^-82
+        0xf2d56790ab41c2a2ull, 0xfae27299423fb9c4ull, // 10^-81
+        0x97c560ba6b0919a5ull, 0xdccd879fc967d41bull, // 10^-80
+        0xbdb6b8e905cb600full, 0x5400e987bbc1c921ull, // 10^-79
+        0xed246723473e3813ull, 0x290123e9aab23b69ull, // 10^-78
+        0x9436c0760c86e30bull, 0xf9a0b6720aaf6522ull, // 10^-77
+        0xb94470938fa89bceull, 0xf808e40e8d5b3e6aull, // 10^-76
+        0xe7958cb87392c2c2ull, 0xb60b1d1230b20e05ull, // 10^-75
+        0x90bd77f3483bb9b9ull, 0xb1c6f22b5e6f48c3ull, // 10^-74
+        0xb4ecd5f01a4aa828ull, 0x1e38aeb6360b1af4ull, // 10^-73
+        0xe2280b6c20dd5232ull, 0x25c6da63c38de1b1ull, // 10^-72
+        0x8d590723948a535full, 0x579c487e5a38ad0full, // 10^-71
+        0xb0af48ec79ace837ull, 0x2d835a9df0c6d852ull, // 10^-70
+        0xdcdb1b2798182244ull, 0xf8e431456cf88e66ull, // 10^-69
+        0x8a08f0f8bf0f156bull, 0x1b8e9ecb641b5900ull, // 10^-68
+        0xac8b2d36eed2dac5ull, 0xe272467e3d222f40ull, // 10^-67
+        0xd7adf884aa879177ull, 0x5b0ed81dcc6abb10ull, // 10^-66
+        0x86ccbb52ea94baeaull, 0x98e947129fc2b4eaull, // 10^-65
+        0xa87fea27a539e9a5ull, 0x3f2398d747b36225ull, // 10^-64
+        0xd29fe4b18e88640eull, 0x8eec7f0d19a03aaeull, // 10^-63
+        0x83a3eeeef9153e89ull, 0x1953cf68300424adull, // 10^-62
+        0xa48ceaaab75a8e2bull, 0x5fa8c3423c052dd8ull, // 10^-61
+        0xcdb02555653131b6ull, 0x3792f412cb06794eull, // 10^-60
+        0x808e17555f3ebf11ull, 0xe2bbd88bbee40bd1ull, // 10^-59
+        0xa0b19d2ab70e6ed6ull, 0x5b6aceaeae9d0ec5ull, // 10^-58
+        0xc8de047564d20a8bull, 0xf245825a5a445276ull, // 10^-57
+        0xfb158592be068d2eull, 0xeed6e2f0f0d56713ull, // 10^-56
+        0x9ced737bb6c4183dull, 0x55464dd69685606cull, // 10^-55
+        0xc428d05aa4751e4cull, 0xaa97e14c3c26b887ull, // 10^-54
+        0xf53304714d9265dfull, 0xd53dd99f4b3066a9ull, // 10^-53
+        0x993fe2c6d07b7fabull, 0xe546a8038efe402aull, // 10^-52
+        0xbf8fdb78849a5f96ull, 0xde98520472bdd034ull, // 10^-51
+        0xef73d256a5c0f77cull, 0x963e66858f6d4441ull, // 10^-50
+        0x95a8637627989aadull, 0xdde7001379a44aa9ull, // 10^-49
+        0xbb127c53b17ec159ull, 0x5560c018580d5d53ull, // 10^-48
+        0xe9d71b689dde71afull, 0xaab8f01e6e10b4a7ull, // 10^-47
+        0x9226712162ab070dull, 0xcab3961304ca70e9ull, // 10^-46
+        0xb6b00d69bb55c8d1ull, 0x3d607b97c5fd0d23ull, // 10^-45
+        0xe45c10c42a2b3b05ull, 0x8cb89a7db77c506bull, // 10^-44
+        0x8eb98a7a9a5b04e3ull, 0x77f3608e92adb243ull, // 10^-43
+        0xb267ed1940f1c61cull, 0x55f038b237591ed4ull, // 10^-42
+        0xdf01e85f912e37a3ull, 0x6b6c46dec52f6689ull, // 10^-41
+        0x8b61313bbabce2c6ull, 0x2323ac4b3b3da016ull, // 10^-40
+        0xae397d8aa96c1b77ull, 0xabec975e0a0d081bull, // 10^-39
+        0xd9c7dced53c72255ull, 0x96e7bd358c904a22ull, // 10^-38
+        0x881cea14545c7575ull, 0x7e50d64177da2e55ull, // 10^-37
+        0xaa242499697392d2ull, 0xdde50bd1d5d0b9eaull, // 10^-36
+        0xd4ad2dbfc3d07787ull, 0x955e4ec64b44e865ull, // 10^-35
+        0x84ec3c97da624ab4ull, 0xbd5af13bef0b113full, // 10^-34
+        0xa6274bbdd0fadd61ull, 0xecb1ad8aeacdd58full, // 10^-33
+        0xcfb11ead453994baull, 0x67de18eda5814af3ull, // 10^-32
+        0x81ceb32c4b43fcf4ull, 0x80eacf948770ced8ull, // 10^-31
+        0xa2425ff75e14fc31ull, 0xa1258379a94d028eull, // 10^-30
+        0xcad2f7f5359a3b3eull, 0x096ee45813a04331ull, // 10^-29
+        0xfd87b5f28300ca0dull, 0x8bca9d6e188853fdull, // 10^-28
+        0x9e74d1b791e07e48ull, 0x775ea264cf55347eull, // 10^-27
+        0xc612062576589ddaull, 0x95364afe032a819eull, // 10^-26
+        0xf79687aed3eec551ull, 0x3a83ddbd83f52205ull, // 10^-25
+        0x9abe14cd44753b52ull, 0xc4926a9672793543ull, // 10^-24
+        0xc16d9a0095928a27ull, 0x75b7053c0f178294ull, // 10^-23
+        0xf1c90080baf72cb1ull, 0x5324c68b12dd6339ull, // 10^-22
+        0x971da05074da7beeull, 0xd3f6fc16ebca5e04ull, // 10^-21
+        0xbce5086492111aeaull, 0x88f4bb1ca6bcf585ull, // 10^-20
+        0xec1e4a7db69561a5ull, 0x2b31e9e3d06c32e6ull, // 10^-19
+        0x9392ee8e921d5d07ull, 0x3aff322e62439fd0ull, // 10^-18
+        0xb877aa3236a4b449ull, 0x09befeb9fad487c3ull, // 10^-17
+        0xe69594bec44de15bull, 0x4c2ebe687989a9b4ull, // 10^-16
+        0x901d7cf73ab0acd9ull, 0x0f9d37014bf60a11ull, // 10^-15
+        0xb424dc35095cd80full, 0x538484c19ef38c95ull, // 10^-14
+        0xe12e13424bb40e13ull, 0x2865a5f206b06fbaull, // 10^-13
+        0x8cbccc096f5088cbull, 0xf93f87b7442e45d4ull, // 10^-12
+        0xafebff0bcb24aafeull, 0xf78f69a51539d749ull, // 10^-11
+        0xdbe6fecebdedd5beull, 0xb573440e5a884d1cull, // 10^-10
+        0x89705f4136b4a597ull, 0x31680a88f8953031ull, // 10^-9
+        0xabcc77118461cefcull, 0xfdc20d2b36ba7c3eull, // 10^-8
+        0xd6bf94d5e57a42bcull, 0x3d32907604691b4dull, // 10^-7
+        0x8637bd05af6c69b5ull, 0xa63f9a49c2c1b110ull, // 10^-6
+        0xa7c5ac471b478423ull, 0x0fcf80dc33721d54ull, // 10^-5
+        0xd1b71758e219652bull, 0xd3c36113404ea4a9ull, // 10^-4
+        0x83126e978d4fdf3bull, 0x645a1cac083126eaull, // 10^-3
+        0xa3d70a3d70a3d70aull, 0x3d70a3d70a3d70a4ull, // 10^-2
+        0xccccccccccccccccull, 0xcccccccccccccccdull, // 10^-1
+        0x8000000000000000ull, 0x0000000000000001ull, // 10^0
+        0xa000000000000000ull, 0x0000000000000001ull, // 10^1
+        0xc800000000000000ull, 0x0000000000000001ull, // 10^2
+        0xfa00000000000000ull, 0x0000000000000001ull, // 10^3
+        0x9c40000000000000ull, 0x0000000000000001ull, // 10^4
+        0xc350000000000000ull, 0x0000000000000001ull, // 10^5
+        0xf424000000000000ull, 0x0000000000000001ull, // 10^6
+        0x9896800000000000ull, 0x0000000000000001ull, // 10^7
+        0xbebc200000000000ull, 0x0000000000000001ull, // 10^8
+        0xee6b280000000000ull, 0x0000000000000001ull, // 10^9
+        0x9502f90000000000ull, 0x0000000000000001ull, // 10^10
+        0xba43b74000000000ull, 0x0000000000000001ull, // 10^11
+        0xe8d4a51000000000ull, 0x0000000000000001ull, // 10^12
+        0x9184e72a00000000ull, 0x0000000000000001ull, // 10^13
+        0xb5e620f480000000ull, 0x0000000000000001ull, // 10^14
+        0xe35fa931a0000000ull, 0x0000000000000001ull, // 10^15
+        0x8e1bc9bf04000000ull, 0x0000000000000001ull, // 10^16
+        0xb1a2bc2ec5000000ull, 0x0000000000000001ull, // 10^17
+        0xde0b6b3a76400000ull, 0x0000000000000001ull, // 10^18
+        0x8ac7230489e80000ull, 0x0000000000000001ull, // 10^19
+        0xad78ebc5ac620000ull, 0x0000000000000001ull, // 10^20
+        0xd8d726b7177a8000ull, 0x0000000000000001ull, // 10^21
+        0x878678326eac9000ull, 0x0000000000000001ull, // 10^22
+        0xa968163f0a57b400ull, 0x0000000000000001ull, // 10^23
+        0xd3c21bcecceda100ull, 0x0000000000000001ull, // 10^24
+        0x84595161401484a0ull, 0x0000000000000001ull, // 10^25
+        0xa56fa5b99019a5c8ull, 0x0000000000000001ull, // 10^26
+        0xcecb8f27f4200f3aull, 0x0000000000000001ull, // 10^27
+        0x813f3978f8940984ull, 0x4000000000000001ull, // 10^28
+        0xa18f07d736b90be5ull, 0x5000000000000001ull, // 10^29
+        0xc9f2c9cd04674edeull, 0xa400000000000001ull, // 10^30
+        0xfc6f7c4045812296ull, 0x4d00000000000001ull, // 10^31
+        0x9dc5ada82b70b59dull, 0xf020000000000001ull, // 10^32
+        0xc5371912364ce305ull, 0x6c28000000000001ull, // 10^33
+        0xf684df56c3e01bc6ull, 0xc732000000000001ull, // 10^34
+        0x9a130b963a6c115cull, 0x3c7f400000000001ull, // 10^35
+        0xc097ce7bc90715b3ull, 0x4b9f100000000001ull, // 10^36
+        0xf0bdc21abb48db20ull, 0x1e86d40000000001ull, // 10^37
+        0x96769950b50d88f4ull, 0x1314448000000001ull, // 10^38
+        0xbc143fa4e250eb31ull, 0x17d955a000000001ull, // 10^39
+        0xeb194f8e1ae525fdull, 0x5dcfab0800000001ull, // 10^40
+        0x92efd1b8d0cf37beull, 0x5aa1cae500000001ull, // 10^41
+        0xb7abc627050305adull, 0xf14a3d9e40000001ull, // 10^42
+        0xe596b7b0c643c719ull, 0x6d9ccd05d0000001ull, // 10^43
+        0x8f7e32ce7bea5c6full, 0xe4820023a2000001ull, // 10^44
+        0xb35dbf821ae4f38bull, 0xdda2802c8a800001ull, // 10^45
+        0xe0352f62a19e306eull, 0xd50b2037ad200001ull, // 10^46
+        0x8c213d9da502de45ull, 0x4526f422cc340001ull, // 10^47
+        0xaf298d050e4395d6ull, 0x9670b12b7f410001ull, // 10^48
+        0xdaf3f04651d47b4cull, 0x3c0cdd765f114001ull, // 10^49
+        0x88d8762bf324cd0full, 0xa5880a69fb6ac801ull, // 10^50
+        0xab0e93b6efee0053ull, 0x8eea0d047a457a01ull, // 10^51
+        0xd5d238a4abe98068ull, 0x72a4904598d6d881ull, // 10^52
+        0x85a36366eb71f041ull, 0x47a6da2b7f864751ull, // 10^53
+        0xa70c3c40a64e6c51ull, 0x999090b65f67d925ull, // 10^54
+        0xd0cf4b50cfe20765ull, 0xfff4b4e3f741cf6eull, // 10^55
+        0x82818f1281ed449full, 0xbff8f10e7a8921a5ull, // 10^56
+        0xa321f2d7226895c7ull, 0xaff72d52192b6a0eull, // 10^57
+        0xcbea6f8ceb02bb39ull, 0x9bf4f8a69f764491ull, // 10^58
+        0xfee50b7025c36a08ull, 0x02f236d04753d5b5ull, // 10^59
+        0x9f4f2726179a2245ull, 0x01d762422c946591ull, // 10^60
+        0xc722f0ef9d80aad6ull, 0x424d3ad2b7b97ef6ull, // 10^61
+        0xf8ebad2b84e0d58bull, 0xd2e0898765a7deb3ull, // 10^62
+        0x9b934c3b330c8577ull, 0x63cc55f49f88eb30ull, // 10^63
+        0xc2781f49ffcfa6d5ull, 0x3cbf6b71c76b25fcull, // 10^64
+        0xf316271c7fc3908aull, 0x8bef464e3945ef7bull, // 10^65
+        0x97edd871cfda3a56ull, 0x97758bf0e3cbb5adull, // 10^66
+        0xbde94e8e43d0c8ecull, 0x3d52eeed1cbea318ull, // 10^67
+        0xed63a231d4c4fb27ull, 0x4ca7aaa863ee4bdeull, // 10^68
+        0x945e455f24fb1cf8ull, 0x8fe8caa93e74ef6bull, // 10^69
+        0xb975d6b6ee39e436ull, 0xb3e2fd538e122b45ull, // 10^70
+        0xe7d34c64a9c85d44ull, 0x60dbbca87196b617ull, // 10^71
+        0x90e40fbeea1d3a4aull, 0xbc8955e946fe31ceull, // 10^72
+        0xb51d13aea4a488ddull, 0x6babab6398bdbe42ull, // 10^73
+        0xe264589a4dcdab14ull, 0xc696963c7eed2dd2ull, // 10^74
+        0x8d7eb76070a08aecull, 0xfc1e1de5cf543ca3ull, // 10^75
+        0xb0de65388cc8ada8ull, 0x3b25a55f43294bccull, // 10^76
+        0xdd15fe86affad912ull, 0x49ef0eb713f39ebfull, // 10^77
+        0x8a2dbf142dfcc7abull, 0x6e3569326c784338ull, // 10^78
+        0xacb92ed9397bf996ull, 0x49c2c37f07965405ull, // 10^79
+        0xd7e77a8f87daf7fbull, 0xdc33745ec97be907ull, // 10^80
+        0x86f0ac99b4e8dafdull, 0x69a028bb3ded71a4ull, // 10^81
+        0xa8acd7c0222311bcull, 0xc40832ea0d68ce0dull, // 10^82
+        0xd2d80db02aabd62bull, 0xf50a3fa490c30191ull, // 10^83
+        0x83c7088e1aab65dbull, 0x792667c6da79e0fbull, // 10^84
+        0xa4b8cab1a1563f52ull, 0x577001b891185939ull, // 10^85
+        0xcde6fd5e09abcf26ull, 0xed4c0226b55e6f87ull, // 10^86
+        0x80b05e5ac60b6178ull, 0x544f8158315b05b5ull, // 10^87
+        0xa0dc75f1778e39d6ull, 0x696361ae3db1c722ull, // 10^88
+        0xc913936dd571c84cull, 0x03bc3a19cd1e38eaull, // 10^89
+        0xfb5878494ace3a5full, 0x04ab48a04065c724ull, // 10^90
+        0x9d174b2dcec0e47bull, 0x62eb0d64283f9c77ull, // 10^91
+        0xc45d1df942711d9aull, 0x3ba5d0bd324f8395ull, // 10^92
+        0xf5746577930d6500ull, 0xca8f44ec7ee3647aull, // 10^93
+        0x9968bf6abbe85f20ull, 0x7e998b13cf4e1eccull, // 10^94
+        0xbfc2ef456ae276e8ull, 0x9e3fedd8c321a67full, // 10^95
+        0xefb3ab16c59b14a2ull, 0xc5cfe94ef3ea101full, // 10^96
+        0x95d04aee3b80ece5ull, 0xbba1f1d158724a13ull, // 10^97
+        0xbb445da9ca61281full, 0x2a8a6e45ae8edc98ull, // 10^98
+        0xea1575143cf97226ull, 0xf52d09d71a3293beull, // 10^99
+        0x924d692ca61be758ull, 0x593c2626705f9c57ull, // 10^100
+        0xb6e0c377cfa2e12eull, 0x6f8b2fb00c77836dull, // 10^101
+        0xe498f455c38b997aull, 0x0b6dfb9c0f956448ull, // 10^102
+        0x8edf98b59a373fecull, 0x4724bd4189bd5eadull, // 10^103
+        0xb2977ee300c50fe7ull, 0x58edec91ec2cb658ull, // 10^104
+        0xdf3d5e9bc0f653e1ull, 0x2f2967b66737e3eeull, // 10^105
+        0x8b865b215899f46cull, 0xbd79e0d20082ee75ull, // 10^106
+        0xae67f1e9aec07187ull, 0xecd8590680a3aa12ull, // 10^107
+        0xda01ee641a708de9ull, 0xe80e6f4820cc9496ull, // 10^108
+        0x884134fe908658b2ull, 0x3109058d147fdcdeull, // 10^109
+        0xaa51823e34a7eedeull, 0xbd4b46f0599fd416ull, // 10^110
+        0xd4e5e2cdc1d1ea96ull, 0x6c9e18ac7007c91bull, // 10^111
+        0x850fadc09923329eull, 0x03e2cf6bc604ddb1ull, // 10^112
+        0xa6539930bf6bff45ull, 0x84db8346b786151dull, // 10^113
+        0xcfe87f7cef46ff16ull, 0xe612641865679a64ull, // 10^114
+        0x81f14fae158c5f6eull, 0x4fcb7e8f3f60c07full, // 10^115
+        0xa26da3999aef7749ull, 0xe3be5e330f38f09eull, // 10^116
+        0xcb090c8001ab551cull, 0x5cadf5bfd3072cc6ull, // 10^117
+        0xfdcb4fa002162a63ull, 0x73d9732fc7c8f7f7ull, // 10^118
+        0x9e9f11c4014dda7eull, 0x2867e7fddcdd9afbull, // 10^119
+        0xc646d63501a1511dull, 0xb281e1fd541501b9ull, // 10^120
+        0xf7d88bc24209a565ull, 0x1f225a7ca91a4227ull, // 10^121
+        0x9ae757596946075full, 0x3375788de9b06959ull, // 10^122
+        0xc1a12d2fc3978937ull, 0x0052d6b1641c83afull, // 10^123
+        0xf209787bb47d6b84ull, 0xc0678c5dbd23a49bull, // 10^124
+        0x9745eb4d50ce6332ull, 0xf840b7ba963646e1ull, // 10^125
+        0xbd176620a501fbffull, 0xb650e5a93bc3d899ull, // 10^126
+        0xec5d3fa8ce427affull, 0xa3e51f138ab4cebfull, // 10^127
+        0x93ba47c980e98cdfull, 0xc66f336c36b10138ull, // 10^128
+        0xb8a8d9bbe123f017ull, 0xb80b0047445d4185ull, // 10^129
+        0xe6d3102ad96cec1dull, 0xa60dc059157491e6ull, // 10^130
+        0x9043ea1ac7e41392ull, 0x87c89837ad68db30ull, // 10^131
+        0xb454e4a179dd1877ull, 0x29babe4598c311fcull, // 10^132
+        0xe16a1dc9d8545e94ull, 0xf4296dd6fef3d67bull, // 10^133
+        0x8ce2529e2734bb1dull, 0x1899e4a65f58660dull, // 10^134
+        0xb01ae745b101e9e4ull, 0x5ec05dcff72e7f90ull, // 10^135
+        0xdc21a1171d42645dull, 0x76707543f4fa1f74ull, // 10^136
+        0x899504ae72497ebaull, 0x6a06494a791c53a9ull, // 10^137
+        0xabfa45da0edbde69ull, 0x0487db9d17636893ull, // 10^138
+        0xd6f8d7509292d603ull, 0x45a9d2845d3c42b7ull, // 10^139
+        0x865b86925b9bc5c2ull, 0x0b8a2392ba45a9b3ull, // 10^140
+        0xa7f26836f282b732ull, 0x8e6cac7768d7141full, // 10^141
+        0xd1ef0244af2364ffull, 0x3207d795430cd927ull, // 10^142
+        0x8335616aed761f1full, 0x7f44e6bd49e807b9ull, // 10^143
+        0xa402b9c5a8d3a6e7ull, 0x5f16206c9c6209a7ull, // 10^144
+        0xcd036837130890a1ull, 0x36dba887c37a8c10ull, // 10^145
+        0x802221226be55a64ull, 0xc2494954da2c978aull, // 10^146
+        0xa02aa96b06deb0fdull, 0xf2db9baa10b7bd6dull, // 10^147
+        0xc83553c5c8965d3dull, 0x6f92829494e5acc8ull, // 10^148
+        0xfa42a8b73abbf48cull, 0xcb772339ba1f17faull, // 10^149
+        0x9c69a97284b578d7ull, 0xff2a760414536efcull, // 10^150
+        0xc38413cf25e2d70dull, 0xfef5138519684abbull, // 10^151
+        0xf46518c2ef5b8cd1ull, 0x7eb258665fc25d6aull, // 10^152
+        0x98bf2f79d5993802ull, 0xef2f773ffbd97a62ull, // 10^153
+        0xbeeefb584aff8603ull, 0xaafb550ffacfd8fbull, // 10^154
+        0xeeaaba2e5dbf6784ull, 0x95ba2a53f983cf39ull, // 10^155
+        0x952ab45cfa97a0b2ull, 0xdd945a747bf26184ull, // 10^156
+        0xba756174393d88dfull, 0x94f971119aeef9e5ull, // 10^157
+        0xe912b9d1478ceb17ull, 0x7a37cd5601aab85eull, // 10^158
+        0x91abb422ccb812eeull, 0xac62e055c10ab33bull, // 10^159
+        0xb616a12b7fe617aaull, 0x577b986b314d600aull, // 10^160
+        0xe39c49765fdf9d94ull, 0xed5a7e85fda0b80cull, // 10^161
+        0x8e41ade9fbebc27dull, 0x14588f13be847308ull, // 10^162
+        0xb1d219647ae6b31cull, 0x596eb2d8ae258fc9ull, // 10^163
+        0xde469fbd99a05fe3ull, 0x6fca5f8ed9aef3bcull, // 10^164
+        0x8aec23d680043beeull, 0x25de7bb9480d5855ull, // 10^165
+        0xada72ccc20054ae9ull, 0xaf561aa79a10ae6bull, // 10^166
+        0xd910f7ff28069da4ull, 0x1b2ba1518094da05ull, // 10^167
+        0x87aa9aff79042286ull, 0x90fb44d2f05d0843ull, // 10^168
+        0xa99541bf57452b28ull, 0x353a1607ac744a54ull, // 10^169
+        0xd3fa922f2d1675f2ull, 0x42889b8997915ce9ull, // 10^170
+        0x847c9b5d7c2e09b7ull, 0x69956135febada12ull, // 10^171
+        0xa59bc234db398c25ull, 0x43fab9837e699096ull, // 10^172
+        0xcf02b2c21207ef2eull, 0x94f967e45e03f4bcull, // 10^173
+        0x8161afb94b44f57dull, 0x1d1be0eebac278f6ull, // 10^174
+        0xa1ba1ba79e1632dcull, 0x6462d92a69731733ull, // 10^175
+        0xca28a291859bbf93ull, 0x7d7b8f7503cfdcffull, // 10^176
+        0xfcb2cb35e702af78ull, 0x5cda735244c3d43full, // 10^177
+        0x9defbf01b061adabull, 0x3a0888136afa64a8ull, // 10^178
+        0xc56baec21c7a1916ull, 0x088aaa1845b8fdd1ull, // 10^179
+        0xf6c69a72a3989f5bull, 0x8aad549e57273d46ull, // 10^180
+        0x9a3c2087a63f6399ull, 0x36ac54e2f678864cull, // 10^181
+        0xc0cb28a98fcf3c7full, 0x84576a1bb416a7deull, // 10^182
+        0xf0fdf2d3f3c30b9full, 0x656d44a2a11c51d6ull, // 10^183
+        0x969eb7c47859e743ull, 0x9f644ae5a4b1b326ull, // 10^184
+        0xbc4665b596706114ull, 0x873d5d9f0dde1fefull, // 10^185
+        0xeb57ff22fc0c7959ull, 0xa90cb506d155a7ebull, // 10^186
+        0x9316ff75dd87cbd8ull, 0x09a7f12442d588f3ull, // 10^187
+        0xb7dcbf5354e9beceull, 0x0c11ed6d538aeb30ull, // 10^188
+        0xe5d3ef282a242e81ull, 0x8f1668c8a86da5fbull, // 10^189
+        0x8fa475791a569d10ull, 0xf96e017d694487bdull, // 10^190
+        0xb38d92d760ec4455ull, 0x37c981dcc395a9adull, // 10^191
+        0xe070f78d3927556aull, 0x85bbe253f47b1418ull, // 10^192
+        0x8c469ab843b89562ull, 0x93956d7478ccec8full, // 10^193
+        0xaf58416654a6babbull, 0x387ac8d1970027b3ull, // 10^194
+        0xdb2e51bfe9d0696aull, 0x06997b05fcc0319full, // 10^195
+        0x88fcf317f22241e2ull, 0x441fece3bdf81f04ull, // 10^196
+        0xab3c2fddeeaad25aull, 0xd527e81cad7626c4ull, // 10^197
+        0xd60b3bd56a5586f1ull, 0x8a71e223d8d3b075ull, // 10^198
+        0x85c7056562757456ull, 0xf6872d5667844e4aull, // 10^199
+        0xa738c6bebb12d16cull, 0xb428f8ac016561dcull, // 10^200
+        0xd106f86e69d785c7ull, 0xe13336d701beba53ull, // 10^201
+        0x82a45b450226b39cull, 0xecc0024661173474ull, // 10^202
+        0xa34d721642b06084ull, 0x27f002d7f95d0191ull, // 10^203
+        0xcc20ce9bd35c78a5ull, 0x31ec038df7b441f5ull, // 10^204
+        0xff290242c83396ceull, 0x7e67047175a15272ull, // 10^205
+        0x9f79a169bd203e41ull, 0x0f0062c6e984d387ull, // 10^206
+        0xc75809c42c684dd1ull, 0x52c07b78a3e60869ull, // 10^207
+        0xf92e0c3537826145ull, 0xa7709a56ccdf8a83ull, // 10^208
+        0x9bbcc7a142b17ccbull, 0x88a66076400bb692ull, // 10^209
+        0xc2abf989935ddbfeull, 0x6acff893d00ea436ull, // 10^210
+        0xf356f7ebf83552feull, 0x0583f6b8c4124d44ull, // 10^211
+        0x98165af37b2153deull, 0xc3727a337a8b704bull, // 10^212
+        0xbe1bf1b059e9a8d6ull, 0x744f18c0592e4c5dull, // 10^213
+        0xeda2ee1c7064130cull, 0x1162def06f79df74ull, // 10^214
+        0x9485d4d1c63e8be7ull, 0x8addcb5645ac2ba9ull, // 10^215
+        0xb9a74a0637ce2ee1ull, 0x6d953e2bd7173693ull, // 10^216
+        0xe8111c87c5c1ba99ull, 0xc8fa8db6ccdd0438ull, // 10^217
+        0x910ab1d4db9914a0ull, 0x1d9c9892400a22a3ull, // 10^218
+        0xb54d5e4a127f59c8ull, 0x2503beb6d00cab4cull, // 10^219
+        0xe2a0b5dc971f303aull, 0x2e44ae64840fd61eull, // 10^220
+        0x8da471a9de737e24ull, 0x5ceaecfed289e5d3ull, // 10^221
+        0xb10d8e1456105dadull, 0x7425a83e872c5f48ull, // 10^222
+        0xdd50f1996b947518ull, 0xd12f124e28f7771aull, // 10^223
+        0x8a5296ffe33cc92full, 0x82bd6b70d99aaa70ull, // 10^224
+        0xace73cbfdc0bfb7bull, 0x636cc64d1001550cull, // 10^225
+        0xd8210befd30efa5aull, 0x3c47f7e05401aa4full, // 10^226
+        0x8714a775e3e95c78ull, 0x65acfaec34810a72ull, // 10^227
+        0xa8d9d1535ce3b396ull, 0x7f1839a741a14d0eull, // 10^228
+        0xd31045a8341ca07cull, 0x1ede48111209a051ull, // 10^229
+        0x83ea2b892091e44dull, 0x934aed0aab460433ull, // 10^230
+        0xa4e4b66b68b65d60ull, 0xf81da84d56178540ull, // 10^231
+        0xce1de40642e3f4b9ull, 0x36251260ab9d668full, // 10^232
+        0x80d2ae83e9ce78f3ull, 0xc1d72b7c6b42601aull, // 10^233
+        0xa1075a24e4421730ull, 0xb24cf65b8612f820ull, // 10^234
+        0xc94930ae1d529cfcull, 0xdee033f26797b628ull, // 10^235
+        0xfb9b7cd9a4a7443cull, 0x169840ef017da3b2ull, // 10^236
+        0x9d412e0806e88aa5ull, 0x8e1f289560ee864full, // 10^237
+        0xc491798a08a2ad4eull, 0xf1a6f2bab92a27e3ull, // 10^238
+        0xf5b5d7ec8acb58a2ull, 0xae10af696774b1dcull, // 10^239
+        0x9991a6f3d6bf1765ull, 0xacca6da1e0a8ef2aull, // 10^240
+        0xbff610b0cc6edd3full, 0x17fd090a58d32af4ull, // 10^241
+        0xeff394dcff8a948eull, 0xddfc4b4cef07f5b1ull, // 10^242
+        0x95f83d0a1fb69cd9ull, 0x4abdaf101564f98full, // 10^243
+        0xbb764c4ca7a4440full, 0x9d6d1ad41abe37f2ull, // 10^244
+        0xea53df5fd18d5513ull, 0x84c86189216dc5eeull, // 10^245
+        0x92746b9be2f8552cull, 0x32fd3cf5b4e49bb5ull, // 10^246
+        0xb7118682dbb66a77ull, 0x3fbc8c33221dc2a2ull, // 10^247
+        0xe4d5e82392a40515ull, 0x0fabaf3feaa5334bull, // 10^248
+        0x8f05b1163ba6832dull, 0x29cb4d87f2a7400full, // 10^249
+        0xb2c71d5bca9023f8ull, 0x743e20e9ef511013ull, // 10^250
+        0xdf78e4b2bd342cf6ull, 0x914da9246b255417ull, // 10^251
+        0x8bab8eefb6409c1aull, 0x1ad089b6c2f7548full, // 10^252
+        0xae9672aba3d0c320ull, 0xa184ac2473b529b2ull, // 10^253
+        0xda3c0f568cc4f3e8ull, 0xc9e5d72d90a2741full, // 10^254
+        0x8865899617fb1871ull, 0x7e2fa67c7a658893ull, // 10^255
+        0xaa7eebfb9df9de8dull, 0xddbb901b98feeab8ull, // 10^256
+        0xd51ea6fa85785631ull, 0x552a74227f3ea566ull, // 10^257
+        0x8533285c936b35deull, 0xd53a88958f872760ull, // 10^258
+        0xa67ff273b8460356ull, 0x8a892abaf368f138ull, // 10^259
+        0xd01fef10a657842cull, 0x2d2b7569b0432d86ull, // 10^260
+        0x8213f56a67f6b29bull, 0x9c3b29620e29fc74ull, // 10^261
+        0xa298f2c501f45f42ull, 0x8349f3ba91b47b90ull, // 10^262
+        0xcb3f2f7642717713ull, 0x241c70a936219a74ull, // 10^263
+        0xfe0efb53d30dd4d7ull, 0xed238cd383aa0111ull, // 10^264
+        0x9ec95d1463e8a506ull, 0xf4363804324a40abull, // 10^265
+        0xc67bb4597ce2ce48ull, 0xb143c6053edcd0d6ull, // 10^266
+        0xf81aa16fdc1b81daull, 0xdd94b7868e94050bull, // 10^267
+        0x9b10a4e5e9913128ull, 0xca7cf2b4191c8327ull, // 10^268
+        0xc1d4ce1f63f57d72ull, 0xfd1c2f611f63a3f1ull, // 10^269
+        0xf24a01a73cf2dccfull, 0xbc633b39673c8cedull, // 10^270
+        0x976e41088617ca01ull, 0xd5be0503e085d814ull, // 10^271
+        0xbd49d14aa79dbc82ull, 0x4b2d8644d8a74e19ull, // 10^272
+        0xec9c459d51852ba2ull, 0xddf8e7d60ed1219full, // 10^273
+        0x93e1ab8252f33b45ull, 0xcabb90e5c942b504ull, // 10^274
+        0xb8da1662e7b00a17ull, 0x3d6a751f3b936244ull, // 10^275
+        0xe7109bfba19c0c9dull, 0x0cc512670a783ad5ull, // 10^276
+        0x906a617d450187e2ull, 0x27fb2b80668b24c6ull, // 10^277
+        0xb484f9dc9641e9daull, 0xb1f9f660802dedf7ull, // 10^278
+        0xe1a63853bbd26451ull, 0x5e7873f8a0396974ull, // 10^279
+        0x8d07e33455637eb2ull, 0xdb0b487b6423e1e9ull, // 10^280
+        0xb049dc016abc5e5full, 0x91ce1a9a3d2cda63ull, // 10^281
+        0xdc5c5301c56b75f7ull, 0x7641a140cc7810fcull, // 10^282
+        0x89b9b3e11b6329baull, 0xa9e904c87fcb0a9eull, // 10^283
+        0xac2820d9623bf429ull, 0x546345fa9fbdcd45ull, // 10^284
+        0xd732290fbacaf133ull, 0xa97c177947ad4096ull, // 10^285
+        0x867f59a9d4bed6c0ull, 0x49ed8eabcccc485eull, // 10^286
+        0xa81f301449ee8c70ull, 0x5c68f256bfff5a75ull, // 10^287
+        0xd226fc195c6a2f8cull, 0x73832eec6fff3112ull, // 10^288
+        0x83585d8fd9c25db7ull, 0xc831fd53c5ff7eacull, // 10^289
+        0xa42e74f3d032f525ull, 0xba3e7ca8b77f5e56ull, // 10^290
+        0xcd3a1230c43fb26full, 0x28ce1bd2e55f35ecull, // 10^291
+        0x80444b5e7aa7cf85ull, 0x7980d163cf5b81b4ull, // 10^292
+        0xa0555e361951c366ull, 0xd7e105bcc3326220ull, // 10^293
+        0xc86ab5c39fa63440ull, 0x8dd9472bf3fefaa8ull, // 10^294
+        0xfa856334878fc150ull, 0xb14f98f6f0feb952ull, // 10^295
+        0x9c935e00d4b9d8d2ull, 0x6ed1bf9a569f33d4ull, // 10^296
+        0xc3b8358109e84f07ull, 0x0a862f80ec4700c9ull, // 10^297
+        0xf4a642e14c6262c8ull, 0xcd27bb612758c0fbull, // 10^298
+        0x98e7e9cccfbd7dbdull, 0x8038d51cb897789dull, // 10^299
+        0xbf21e44003acdd2cull, 0xe0470a63e6bd56c4ull, // 10^300
+        0xeeea5d5004981478ull, 0x1858ccfce06cac75ull, // 10^301
+        0x95527a5202df0ccbull, 0x0f37801e0c43ebc9ull, // 10^302
+        0xbaa718e68396cffdull, 0xd30560258f54e6bbull, // 10^303
+        0xe950df20247c83fdull, 0x47c6b82ef32a206aull, // 10^304
+        0x91d28b7416cdd27eull, 0x4cdc331d57fa5442ull, // 10^305
+        0xb6472e511c81471dull, 0xe0133fe4adf8e953ull, // 10^306
+        0xe3d8f9e563a198e5ull, 0x58180fddd97723a7ull, // 10^307
+        0x8e679c2f5e44ff8full, 0x570f09eaa7ea7649ull, // 10^308
+        0xb201833b35d63f73ull, 0x2cd2cc6551e513dbull, // 10^309
+        0xde81e40a034bcf4full, 0xf8077f7ea65e58d2ull, // 10^310
+        0x8b112e86420f6191ull, 0xfb04afaf27faf783ull, // 10^311
+        0xadd57a27d29339f6ull, 0x79c5db9af1f9b564ull, // 10^312
+        0xd94ad8b1c7380874ull, 0x18375281ae7822bdull, // 10^313
+        0x87cec76f1c830548ull, 0x8f2293910d0b15b6ull, // 10^314
+        0xa9c2794ae3a3c69aull, 0xb2eb3875504ddb23ull, // 10^315
+        0xd433179d9c8cb841ull, 0x5fa60692a46151ecull, // 10^316
+        0x849feec281d7f328ull, 0xdbc7c41ba6bcd334ull, // 10^317
+        0xa5c7ea73224deff3ull, 0x12b9b522906c0801ull, // 10^318
+        0xcf39e50feae16befull, 0xd768226b34870a01ull, // 10^319
+        0x81842f29f2cce375ull, 0xe6a1158300d46641ull, // 10^320
+        0xa1e53af46f801c53ull, 0x60495ae3c1097fd1ull, // 10^321
+        0xca5e89b18b602368ull, 0x385bb19cb14bdfc5ull, // 10^322
+        0xfcf62c1dee382c42ull, 0x46729e03dd9ed7b6ull, // 10^323
+        0x9e19db92b4e31ba9ull, 0x6c07a2c26a8346d2ull, // 10^324
+    };
+
+    uint64_t m = bits & ((1ull << 52) - 1);
+    uint32_t be = (bits >> 52) & 0x7ff;
+
+    // double is c * 2^q
+    uint64_t c = be ? m | (1ull << 52) : m;
+    int32_t q = (be ? be : 1) - 1075;
+
+    // Small integers are exact
+    if (q <= 0 && q > -53 && !(c & ((1ull << -q) - 1))) {
+        f = c >> -q;
+        k = 0;
+    }
+    else {
+        // Half way to the next, and previous, doubles. The previous is
+        // closer after a power of 2
+        bool closer = m == 0 && be > 1;
+        uint64_t cbl = 4 * c - 2 + closer;
+        uint64_t cb = 4 * c;
+        uint64_t cbr = 4 * c + 2;
+
+        // k = floor(log10(2^q)), or of 3/4 2^q if closer.
+        // h = q + floor(log2(10^-k)) + 1, from 1 to 4
+        k = (q * 1262611 - (closer ? 524031 : 0)) >> 22;
+        int32_t h = q + ((-k * 1741647) >> 19) + 1;
+        const uint64_t* g = pow10 + 2 * (-k + 292);
+
+        // The 3 of them, times 10^-k, with a sticky bit
+        auto rop = [g](uint64_t cp) {
+            unsigned __int128 x = (unsigned __int128)g[1] * cp;
+            unsigned __int128 y = (unsigned __int128)g[0] * cp + (uint64_t)(x >> 64);
+            return (uint64_t)(y >> 64) | ((uint64_t)y > 1);
+        };
+        uint64_t vbl = rop(cbl << h);
+        uint64_t vb = rop(cb << h);
+        uint64_t vbr = rop(cbr << h);
+
+        // Ties to even, like the parser
+        bool even = !(c & 1);
+        uint64_t lower = vbl + !even;
+        uint64_t upper = vbr - !even;
+
+        // One digit less, if either multiple of 10 is in range
+        uint64_t s = vb / 4;
+        bool done = false;
+        if (s >= 10) {
+            uint64_t sp = s / 10;
+            bool up_in = lower <= 40 * sp;
+            bool wp_in = 40 * sp + 40 <= upper;
+            if (up_in != wp_in) {
+                f = sp + wp_in;
+                k += 1;
+                done = true;
+            }
+        }
+
+        // Else the closer of s and s + 1 that is in range
+        if (!done) {
+            bool u_in = lower <= 4 * s;
+            bool w_in = 4 * s + 4 <= upper;
+            if (u_in != w_in) {
+                f = s + w_in;
+            }
+            else {
+                uint64_t mid = 4 * s + 2;
+                f = s + (vb > mid || (vb == mid && (s & 1)));
+            }
+        }
+    }
+
+    // No trailing zeros
+    while (f % 100 == 0) {
+        f /= 100;
+        k += 2;
+    }
+    if (f % 10 == 0) {
+        f /= 10;
+        k += 1;
+    }
+}
+
+// Write the decimal digits of f in d[0, 24), zero padded on the left.
+// Returns the first of the n digits. d is at least 48 bytes
+inline const char* _dtoa_digits(uint64_t f, uint32_t n, char* d) {
+    if (n <= 8)
+        utoap<8>(f, d + 16);
+    else if (n <= 16)
+        utoap<16>(f, d + 8);
+    else
+        utoap<20>(f, d + 4);
+    return d + 24 - n;
+}
+
+// Convert double to the shortest string that parses back to it.
+// Like JavaScript: 123.45, 0.000012, 1.5e+21 or 1e-7, and inf, nan.
+// Buffer is at least 32 bytes, written in whole words. Returns length
+inline uint32_t dtoa(double x, char* buf) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+
+    char s[64];
+    char* p = s;
+    *p = '-';        // Always write
+    p += bits >> 63; // But advance only if negative
+
+    uint64_t e2 = bits & 0x7ff0000000000000ull;
+    if (unlikely(e2 == 0x7ff0000000000000ull)) {
+        memcpy(p, bits << 12 ? "nan" : "inf", 4);
+        p += 3;
+    }
+    else if (unlikely((bits << 1) == 0)) {
+        *p++ = '0';
+    }
+    else {
+        uint64_t f;
+        int32_t k;
+        _schubfach(bits, f, k);
+
+        char d[48];
+        int32_t n = _declen(f);
+        const char* ds = _dtoa_digits(f, n, d);
+
+        // digits are 0.ds * 10^dp
+        int32_t dp = n + k;
+        if (dp > 0 && dp <= 21) {
+            if (dp >= n) {
+                // 12300
+                memcpy(p, ds, 24);
+                memset(p + n, '0', 24);
+                p += dp;
+            }
+            else {
+                // 123.45
+                memcpy(p, ds, 24);
+                p[dp] = '.';
+                memcpy(p + dp + 1, ds + dp, 16);
+                p += n + 1;
+            }
+        }
+        else if (dp <= 0 && dp > -6) {
+            // 0.00012345
+            memcpy(p, "0.000000", 8);
+            memcpy(p + 2 - dp, ds, 24);
+            p += 2 - dp + n;
+        }
+        else {
+            // 1.2345e-7
+            p[0] = ds[0];
+            p[1] = '.';
+            memcpy(p + 2, ds + 1, 16);
+            p += n == 1 ? 1 : n + 1;
+            p[0] = 'e';
+            p[1] = dp - 1 < 0 ? '-' : '+';
+            p += 2;
+            p += itoa8(dp - 1 < 0 ? 1 - dp : dp - 1, p);
+        }
+    }
+
+    *p = '\0';
+    memcpy(buf, s, 32);
+    return p - s;
+}
+
+// Write x * 10^N, that is 2^64 or more and less than 2^128, as %.<N>f
+template <int N>
+inline uint32_t _dtoa_fixed128(bool neg, unsigned __int128 t, char* buf) {
+    // 20 to 39 digits, so more than N
+    char d[48];
+    uint32_t n = utoa128(t, d);
+    char* p = buf;
+    *p = '-';
+    p += neg;
+    memcpy(p, d, n - N);
+    p += n - N;
+    if (N > 0) {
+        *p = '.';
+        memcpy(p + 1, d + n - N, N);
+        p += N + 1;
+    }
+    *p = '\0';
+    return p - buf;
+}
+
+// Write x as %.<N>f with snprintf, for x * 10^N of 2^128 or more
+template <int N>
+inline uint32_t _dtoa_printf(double x, char* buf) {
+    char s[dtoa_fixed_max + 8];
+    uint32_t n = snprintf(s, sizeof(s), "%.*f", N, x);
+    memcpy(buf, s, n + 1);
+    return n;
+}
+
+// Convert double to %.<N>f, N <= 17. Rounded like printf, half way to
+// even of the exact value.
+// *** inf and nan are written as dtoa(x)
+// Buffer is at least 32 bytes, written in whole words, while
+// |x| * 10^N < 2^64. Larger values take up to dtoa_fixed_max bytes.
+// Returns length
+template <int N>
+inline uint32_t dtoa(double x, char* buf) {
+    static_assert(N >= 0 && N <= 17);
+    static const CODE_SECTION uint64_t pow5[18] = {
+        1ull, 5ull, 25ull, 125ull, 625ull, 3125ull, 15625ull, 78125ull,
+        390625ull, 1953125ull, 9765625ull, 48828125ull, 244140625ull,
+        1220703125ull, 6103515625ull, 30517578125ull, 152587890625ull,
+        762939453125ull };
+
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    uint64_t m = bits & ((1ull << 52) - 1);
+    uint32_t be = (bits >> 52) & 0x7ff;
+    if (unlikely(be == 0x7ff))
+        return dtoa(x, buf);
+
+    // x * 10^N is c * 5^N * 2^(e + N). Exact in 128 bits
+    uint64_t c = be ? m | (1ull << 52) : m;
+    int32_t sh = 1075 - (be ? be : 1) - N;
+    unsigned __int128 v = (unsigned __int128)c * pow5[N];
+
+    unsigned __int128 t;
+    if (sh <= 0) {
+        // Past 128 bits, from about 3.4e38 / 10^N, the digits are printf's
+        if (unlikely(-sh >= 128 || (sh < 0 && (v >> (128 + sh)) != 0)))
+            return _dtoa_printf<N>(x, buf);
+        t = v << -sh;
+    }
+    else if (sh < 128) {
+        // v is less than 2^93, so t + 1 does not overflow
+        t = v >> sh;
+        unsigned __int128 rem = v - (t << sh);
+        unsigned __int128 half = (unsigned __int128)1 << (sh - 1);
+        t += rem > half || (rem == half && (t & 1));
+    }
+    else {
+        t = 0;
+    }
+    if (unlikely(t >> 64))
+        return _dtoa_fixed128<N>(bits >> 63, t, buf);
+    uint64_t r = t;
+
+    char s[64];
+    char* p = s;
+    *p = '-';        // Always write
+    p += bits >> 63; // But advance only if negative
+
+    // At least one digit before the dot
+    char d[48];
+    uint32_t n = _declen(r);
+    n = n > N ? n : N + 1;
+    const char* ds = _dtoa_digits(r, n, d);
+
+    memcpy(p, ds, 24);
+    p += n - N;
+    if (N > 0) {
+        *p = '.';
+        memcpy(p + 1, ds + n - N, 24);
+        p += N + 1;
+    }
 
-    // Int of decimal part
-    int64_t dpart = atou(s, len);
+    *p = '\0';
+    memcpy(buf, s, 32);
+    return p - s;
+}
+
+//// Timestamps
+
+// Days since 1970-01-01 of a date in the proleptic Gregorian calendar.
+// Year 1 to 9999. Like days_from_civil in Hinnant, chrono-Compatible
+// Low-Level Date Algorithms, with no branches
+inline int64_t _days_from_civil(uint32_t y, uint32_t m, uint32_t d) {
+    // Years start in March, so the leap day is the last day of the year
+    uint32_t janfeb = m <= 2;
+    y -= janfeb;
+    uint32_t era = y / 400;
+    uint32_t yoe = y - era * 400;
+
+    // Days since March 1st. 153 days per 5 months, from March
+    uint32_t doy = (153 * (m - 3 + 12 * janfeb) + 2) / 5 + d - 1;
+    uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    // 146097 days per 400 years. 719468 days from 0000-03-01 to 1970-01-01
+    return (int64_t)era * 146097 + doe - 719468;
+}
+
+// Date of days since 1970-01-01, days >= 0. Like civil_from_days in Hinnant
+inline void _civil_from_days(uint32_t days, uint32_t& y, uint32_t& m, uint32_t& d) {
+    uint32_t z = days + 719468;
+    uint32_t era = z / 146097;
+    uint32_t doe = z - era * 146097;
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = yoe + era * 400 + (m <= 2);
+}
 
-    // To add the two parts we need matching signs
-    dpart = _copySign(ipart, dpart);
+// Parse YYYYMMDD-HH:MM:SS, with 0 to 9 decimals, to epoch nanoseconds.
+// len is 17 for no decimals, else 18 + decimals.
+// Reads whole words, like atou8, up to 7 bytes past the end
+inline int64_t parse_timestamp(const char* s, uint32_t len) {
+    // Digit pairs in int8's, from "20240315" to 0x..[15]..[03]..[24]..[20].
+    // Each byte is 10 times itself, plus the next one. No carries
+    uint64_t x = cast<uint64_t>(s) - 0x3030303030303030ull;
+    x = x * 10 + (x >> 8);
+    uint32_t y = (x & 0xff) * 100 + ((x >> 16) & 0xff);
+    uint32_t m = (x >> 32) & 0xff;
+    uint32_t d = (x >> 48) & 0xff;
+
+    // Same for "HH:MM:SS". The pairs are in bytes 0, 3 and 6
+    x = cast<uint64_t>(s + 9) - 0x3030303030303030ull;
+    x = x * 10 + (x >> 8);
+    uint32_t sec = (x & 0xff) * 3600 + ((x >> 24) & 0xff) * 60 + ((x >> 48) & 0xff);
+
+    // Decimals, scaled to 9 digits
+    static const CODE_SECTION uint32_t scale[10] = {
+        1000000000, 100000000, 10000000, 1000000, 100000,
+        10000, 1000, 100, 10, 1 };
+    uint32_t n = len > 18 ? len - 18 : 0;
+    n = n < 9 ? n : 9;
+    uint64_t frac = 0;
+    if (n) {
+        frac = _atou8w(cast<uint64_t>(s + 18), n < 8 ? n : 8);
+        if (n == 9)
+            frac = frac * 10 + (s[26] - '0');
+    }
+
+    return (_days_from_civil(y, m, d) * 86400 + sec) * 1000000000 + frac * scale[n];
+}
 
-    // Array of 20 * 8 = 160 bytes
-    static const CODE_SECTION double scales[20] = {
-        1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9, 1e-10,
-        1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18, 1e-19, 1e-20 };
+// Convert epoch nanoseconds, ns >= 0, to YYYYMMDD-HH:MM:SS, with Digits
+// decimals, truncated. 0 <= Digits <= 9, like 3 for milliseconds.
+// Buffer is at least 32 bytes, written in whole words. Returns length
+template <int Digits>
+inline uint32_t format_timestamp(int64_t ns, char* buf) {
+    static_assert(Digits >= 0 && Digits <= 9);
+    uint32_t div = 1;
+    for (int i = Digits; i < 9; i++)
+        div *= 10;
+
+    uint64_t sec = (uint64_t)ns / 1000000000;
+    uint32_t frac = (uint64_t)ns % 1000000000 / div;
+    uint32_t tod = sec % 86400;
+    uint32_t y, m, d;
+    _civil_from_days(sec / 86400, y, m, d);
+
+    // "YYYYMMDD" and "00HHMMSS", a word each. Then the colons go in
+    // between the pairs of "HHMMSS"
+    uint64_t date = _utoa8w(y * 10000 + m * 100 + d);
+    uint64_t t = _utoa8w(tod / 3600 * 10000 + tod / 60 % 60 * 100 + tod % 60);
+    uint64_t time = ((t >> 16) & 0xffff) | ((t >> 8) & 0xffff000000ull) |
+                    (t & 0xffff000000000000ull) | 0x00003a00003a0000ull;
+    memcpy(buf, &date, 8);
+    buf[8] = '-';
+    memcpy(buf + 9, &time, 8);
+
+    uint32_t len = 17;
+    if constexpr (Digits > 0) {
+        buf[17] = '.';
+        if constexpr (Digits <= 8) {
+            // Shift out the leading zeros
+            uint64_t w = _utoa8w(frac) >> ((8 - Digits) * 8);
+            memcpy(buf + 18, &w, 8);
+        }
+        else {
+            buf[18] = '0' + frac / 100000000;
+            uint64_t w = _utoa8w(frac % 100000000);
+            memcpy(buf + 19, &w, 8);
+        }
+        len = 18 + Digits;
+    }
 
-    return ipart + dpart * scales[len];
+    buf[len] = '\0';
+    return len;
 }
 
 } // namespace swar
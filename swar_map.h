@@ -0,0 +1,353 @@
+#pragma once
+
+#include "swar.h"
+
+#include <new> // for placement new
+#include <stdlib.h> // for aligned_alloc
+#include <type_traits>
+#include <utility>
+
+namespace swar {
+
+//
+// Hash map keyed by short strings, like symbols and venue codes
+//
+// Keys are up to 16 bytes, packed into 2 words with cast8 and stored in the
+// slots, so a lookup neither allocates nor follows a pointer. Slots are in
+// groups of 8, with a word of 8 tags per group, so one load and a SWAR
+// compare check 8 slots. The tags and the slots are cache line aligned.
+// Like the other SWAR functions, reads whole words, up to 7 bytes past the
+// end of the key.
+//
+//   swar::short_string_map<uint32_t> ids(20000);
+//   ids.insert("IBM", 3, 1);
+//   if (uint32_t* id = ids.find(sym, len))
+//       ...
+//
+template<typename V>
+class short_string_map {
+public:
+    static const uint32_t max_key = 16;
+
+    // Room for n keys before it grows
+    explicit short_string_map(uint32_t n = 0) {
+        alloc(groups_for(n));
+    }
+
+    ~short_string_map() {
+        destroy();
+        free(tags);
+    }
+
+    short_string_map(const short_string_map&) = delete;
+    short_string_map& operator=(const short_string_map&) = delete;
+
+    uint32_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // Find key. Returns null if not found
+    V* find(const char* s, uint32_t len) {
+        if (unlikely(len > max_key))
+            return nullptr;
+        uint64_t k0, k1;
+        pack(s, len, k0, k1);
+        slot* p = locate(k0, k1, len, hash(k0, k1));
+        return p ? &p->value : nullptr;
+    }
+
+    const V* find(const char* s, uint32_t len) const {
+        return const_cast<short_string_map*>(this)->find(s, len);
+    }
+
+    // Insert, if the key is not there. Returns the value, new or existing,
+    // and whether it was inserted. Keys longer than max_key are not
+    // inserted, and return null
+    std::pair<V*, bool> insert(const char* s, uint32_t len, const V& v) {
+        if (unlikely(len > max_key))
+            return std::pair<V*, bool>(nullptr, false);
+        uint64_t k0, k1;
+        pack(s, len, k0, k1);
+        uint64_t h = hash(k0, k1);
+        if (slot* p = locate(k0, k1, len, h))
+            return std::pair<V*, bool>(&p->value, false);
+
+        // Keep at least 1/8 of the slots empty, so probes end
+        if (unlikely((used + 1) * 8 > (mask + 1) * 8 * 7)) {
+            rehash(groups_for(2 * (count + 1)));
+        }
+        slot* p = place(h);
+        p->k0 = k0;
+        p->k1 = k1;
+        p->len = len;
+        new (&p->value) V(v);
+        count++;
+        return std::pair<V*, bool>(&p->value, true);
+    }
+
+    // Remove key. Returns false if not found
+    bool erase(const char* s, uint32_t len) {
+        if (unlikely(len > max_key))
+            return false;
+        uint64_t k0, k1;
+        pack(s, len, k0, k1);
+        slot* p = locate(k0, k1, len, hash(k0, k1));
+        if (!p)
+            return false;
+
+        // A group with an empty slot was never full, so no probe went past
+        // it, and the slot can be empty again. Otherwise leave a tombstone
+        uint64_t i = p - slots;
+        uint8_t* tag = (uint8_t*)&tags[i / 8] + i % 8;
+        if (_zerobytes<false>(tags[i / 8])) {
+            *tag = empty_tag;
+            used--;
+        }
+        else {
+            *tag = deleted_tag;
+        }
+        p->value.~V();
+        count--;
+        return true;
+    }
+
+    // Remove all keys. Keeps the memory
+    void clear() {
+        destroy();
+        memset(tags, 0, (mask + 1) * 8);
+        count = 0;
+        used = 0;
+    }
+
+private:
+    struct slot {
+        uint64_t k0;
+        uint64_t k1;
+        uint32_t len;
+        V value;
+    };
+
+    // Tag bytes. Used slots have the high bit set, and 7 bits of the hash
+    static const uint8_t empty_tag = 0;
+    static const uint8_t deleted_tag = 1;
+
+    // Pack up to 16 chars into 2 words
+    static void pack(const char* s, uint32_t len, uint64_t& k0, uint64_t& k1) {
+        // No load for the second word of a key of up to 8 chars
+        k0 = cast8(s, len < 8 ? len : 8);
+        k1 = len > 8 ? cast8(s + 8, len - 8) : 0;
+    }
+
+    // Multiply-shift. The high bits pick the group, and the tag
+    static uint64_t hash(uint64_t k0, uint64_t k1) {
+        return ((k0 * 0x9e3779b97f4a7c15ull) ^ k1) * 0xd6e8feb86659fd93ull;
+    }
+
+    // Number of groups, a power of 2, for n keys at up to 7/8 full.
+    // At least 2, so the group shift is less than 64
+    static uint64_t groups_for(uint64_t n) {
+        uint64_t g = 2;
+        while (g * 8 * 7 < n * 8)
+            g *= 2;
+        return g;
+    }
+
+    // The tag of hash h, in all 8 bytes
+    uint64_t tagword(uint64_t h) const {
+        return extend<uint64_t>(0x80 | (h >> (shift - 7)));
+    }
+
+    // Find the slot of key, or null
+    slot* locate(uint64_t k0, uint64_t k1, uint32_t len, uint64_t h) const {
+        uint64_t t = tagword(h);
+        for (uint64_t g = h >> shift;; g = (g + 1) & mask) {
+            uint64_t x = tags[g];
+            for (uint64_t m = _zerobytes<false>(x ^ t); m; m &= m - 1) {
+                slot* p = slots + g * 8 + _bytepos<true, false>(m);
+                if (((p->k0 ^ k0) | (p->k1 ^ k1) | (p->len ^ len)) == 0)
+                    return p;
+            }
+            // An empty slot ends the probe
+            if (_zerobytes<false>(x))
+                return nullptr;
+        }
+    }
+
+    // Take the first empty or deleted slot for hash h, and tag it
+    slot* place(uint64_t h) {
+        for (uint64_t g = h >> shift;; g = (g + 1) & mask) {
+            // Free slots have the high bit clear
+            uint64_t avail = ~tags[g] & 0x8080808080808080ull;
+            if (avail) {
+                uint32_t i = _bytepos<true, false>(avail);
+                uint8_t* tag = (uint8_t*)&tags[g] + i;
+                used += *tag == empty_tag;
+                *tag = (uint8_t)tagword(h);
+                return slots + g * 8 + i;
+            }
+        }
+    }
+
+    // Tags, then slots, in one cache line aligned block
+    void alloc(uint64_t groups) {
+        uint64_t tagsize = (groups * 8 + 63) & ~63ull;
+        uint64_t size = (tagsize + groups * 8 * sizeof(slot) + 63) & ~63ull;
+        tags = (uint64_t*)aligned_alloc(64, size);
+        assert(tags);
+        memset(tags, 0, groups * 8);
+        slots = (slot*)((char*)tags + tagsize);
+        mask = groups - 1;
+        shift = 64 - __builtin_ctzll(groups);
+    }
+
+    void destroy() {
+        if (std::is_trivially_destructible<V>::value)
+            return;
+        for (uint64_t i = 0; i < (mask + 1) * 8; i++) {
+            if (((uint8_t*)tags)[i] & 0x80)
+                slots[i].value.~V();
+        }
+    }
+
+    void rehash(uint64_t groups) {
+        uint64_t* oldtags = tags;
+        slot* oldslots = slots;
+        uint64_t n = (mask + 1) * 8;
+        alloc(groups);
+        used = 0;
+        for (uint64_t i = 0; i < n; i++) {
+            if (((uint8_t*)oldtags)[i] & 0x80) {
+                slot& o = oldslots[i];
+                slot* p = place(hash(o.k0, o.k1));
+                p->k0 = o.k0;
+                p->k1 = o.k1;
+                p->len = o.len;
+                new (&p->value) V(std::move(o.value));
+                o.value.~V();
+            }
+        }
+        free(oldtags);
+    }
+
+    uint64_t* tags = nullptr;
+    slot* slots = nullptr;
+    uint64_t mask = 0; // groups - 1
+    uint32_t shift = 64; // 64 - log2(groups)
+    uint32_t count = 0; // keys
+    uint32_t used = 0; // keys and tombstones
+};
+
+// Called, in a constant expression, only if no perfect hash was found, so
+// the build fails with this name
+inline void _keyword_map_failed() { assert(false); }
+
+//
+// Compile time perfect hash of keywords, of up to 8 chars, to values
+//
+// For small fixed vocabularies, like FIX MsgType, Side or venue codes. The
+// table is built at compile time, by searching for a multiplier that puts
+// each keyword's cast8 in its own slot. A lookup is one masked 8 byte load,
+// one multiply-shift and one compare, with no branch. Reads 8 bytes from s.
+//
+//   enum class msg_type { none, new_order, cancel, exec_report };
+//   constexpr swar::keyword_map<msg_type, 3> msg_types({
+//       { "D", msg_type::new_order },
+//       { "F", msg_type::cancel },
+//       { "8", msg_type::exec_report } }, msg_type::none);
+//   msg_type t = msg_types.find(value, len);
+//
+template<typename E, uint32_t N>
+class keyword_map {
+public:
+    struct entry {
+        const char* word;
+        E value;
+    };
+
+    // Keywords must be distinct, and of 1 to 8 chars
+    constexpr keyword_map(const entry (&entries)[N], E none)
+        : table{}, mul(0), shift(64) {
+        uint64_t keys[N] = {};
+        uint32_t lens[N] = {};
+        for (uint32_t i = 0; i < N; i++) {
+            const char* w = entries[i].word;
+            uint32_t len = 0;
+            for (; w[len]; len++) {
+                if (len < 8)
+                    keys[i] |= uint64_t((uint8_t)w[len]) << (len * 8);
+            }
+            if (len == 0 || len > 8)
+                _keyword_map_failed();
+            lens[i] = len;
+        }
+
+        // Smallest table first, then up to 4 times larger
+        for (uint32_t bits = min_bits; bits <= min_bits + 2; bits++) {
+            uint64_t seed = 0;
+            for (uint32_t tries = 0; tries < 10000; tries++) {
+                // splitmix64, odd
+                uint64_t m = (seed += 0x9e3779b97f4a7c15ull);
+                m = (m ^ (m >> 30)) * 0xbf58476d1ce4e5b9ull;
+                m = (m ^ (m >> 27)) * 0x94d049bb133111ebull;
+                m = (m ^ (m >> 31)) | 1;
+
+                bool used[size] = {};
+                bool ok = true;
+                for (uint32_t i = 0; i < N && ok; i++) {
+                    uint64_t h = (keys[i] * m) >> (64 - bits);
+                    ok = !used[h];
+                    used[h] = true;
+                }
+                if (ok) {
+                    mul = m;
+                    shift = 64 - bits;
+                    for (uint32_t i = 0; i <= size; i++)
+                        table[i].value = none;
+                    for (uint32_t i = 0; i < N; i++) {
+                        slot& e = table[(keys[i] * m) >> shift];
+                        e.key = keys[i];
+                        e.len = lens[i];
+                        e.value = entries[i].value;
+                    }
+                    return;
+                }
+            }
+        }
+        _keyword_map_failed();
+    }
+
+    // Value of keyword s, or none. Any len, s need not be a keyword
+    E find(const char* s, uint32_t len) const {
+        uint64_t x = cast8(s, len < 8 ? len : 8);
+        uint64_t i = (x * mul) >> shift;
+        const slot& e = table[i];
+        // On a miss, the value of the last slot, that is none. Index
+        // arithmetic, and not a select of the value, that the compiler may
+        // turn into a branch. Empty slots have len 0 and value none too
+        uint64_t miss = ((e.key ^ x) | (e.len ^ len)) != 0;
+        return table[(i & (miss - 1)) | (size & -miss)].value;
+    }
+
+private:
+    struct slot {
+        uint64_t key;
+        uint32_t len;
+        E value;
+    };
+
+    // log2 of the smallest power of 2 >= n. At least 1, so the shift is
+    // less than 64
+    static constexpr uint32_t ceil_log2(uint32_t n) {
+        uint32_t b = 1;
+        while ((1u << b) < n)
+            b++;
+        return b;
+    }
+    static constexpr uint32_t min_bits = ceil_log2(N);
+    static constexpr uint32_t size = 4u << min_bits;
+
+    slot table[size + 1]; // and none, for a miss
+    uint64_t mul;
+    uint32_t shift;
+};
+
+} // namespace swar
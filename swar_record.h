@@ -0,0 +1,221 @@
+#pragma once
+
+#include "swar.h"
+
+#include <stddef.h>
+#include <algorithm> // for std::max
+#include <tuple>
+#include <utility>
+
+namespace swar {
+
+//
+// Fixed width text records
+//
+// A record type lists its fields, each with an offset, a width and a
+// type. Every field is dispatched at compile time to the parser for its
+// width, like atou4, atou8, atou, htou8 or cast8, so parsing a record is
+// unrolled, with no loop and no branch on the layout.
+//
+//   typedef swar::record<
+//       swar::field<0, 8, swar::u32>,        // account
+//       swar::field<8, 12, swar::fixed<4>>,  // price
+//       swar::field<20, 6, swar::alpha>      // symbol
+//   > trade;
+//
+//   trade::values v = trade::parse(line);
+//   uint32_t account = std::get<0>(v);
+//   int64_t price = trade::get<1>(line);
+//
+// Numbers may be padded with zeros or spaces on the left, as a space
+// parses as 0. A sign must be in the first char, before any padding.
+// Like the other SWAR functions, fields are read in whole words, up to 16
+// bytes from the start of a field, so keep 16 readable bytes after the
+// last record, like padded_buffer does.
+//
+
+//// Field types
+
+// Parse field of type T and width W, at base, base + stride, etc.
+// One at a time, for types without a batch parser
+template<typename T, uint32_t W>
+inline void _parse_each(const char* base, size_t stride, typename T::value_type* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = T::template parse<W>(base + i * stride);
+}
+
+// Decimal uint of up to 9 chars, so any value fits. u64 for 10 chars
+struct u32 {
+    typedef uint32_t value_type;
+
+    template<uint32_t W>
+    static constexpr value_type parse(const char* s) {
+        static_assert(W >= 1 && W <= 9);
+        if constexpr (W <= 4)
+            return atou4(s, W);
+        else if constexpr (W <= 8)
+            return atou8(s, W);
+        else
+            return atou(s, W);
+    }
+
+    template<uint32_t W>
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        if constexpr (W <= 8)
+            atou8_batch(base, stride, W, out, n);
+        else
+            _parse_each<u32, W>(base, stride, out, n);
+    }
+};
+
+// Decimal uint of up to 20 chars
+struct u64 {
+    typedef uint64_t value_type;
+
+    template<uint32_t W>
+    static constexpr value_type parse(const char* s) {
+        static_assert(W >= 1 && W <= 20);
+        if constexpr (W <= 8)
+            return atou8(s, W);
+        else
+            return atou(s, W);
+    }
+
+    template<uint32_t W>
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        atou_batch(base, stride, W, out, n);
+    }
+};
+
+// Decimal int of up to 20 chars, with the sign, if any, in the first char
+struct i64 {
+    typedef int64_t value_type;
+
+    template<uint32_t W>
+    static constexpr value_type parse(const char* s) {
+        static_assert(W >= 1 && W <= 20);
+        return atoi(s, W);
+    }
+
+    template<uint32_t W>
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        _parse_each<i64, W>(base, stride, out, n);
+    }
+};
+
+// Hex uint of up to 16 chars
+struct hex {
+    typedef uint64_t value_type;
+
+    template<uint32_t W>
+    static constexpr value_type parse(const char* s) {
+        static_assert(W >= 1 && W <= 16);
+        if constexpr (W <= 8)
+            return htou8(s, W);
+        else
+            return htou(s, W);
+    }
+
+    template<uint32_t W>
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        _parse_each<hex, W>(base, stride, out, n);
+    }
+};
+
+// Decimal, like "-123.45", to int64_t ticks of 10^-Scale, like atofixed.
+// The sign, if any, in the first char
+template<int Scale>
+struct fixed {
+    typedef int64_t value_type;
+
+    template<uint32_t W>
+    static value_type parse(const char* s) {
+        static_assert(W >= 1 && W <= 40);
+        return atofixed<Scale>(s, W);
+    }
+
+    template<uint32_t W>
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        _parse_each<fixed, W>(base, stride, out, n);
+    }
+};
+
+// Up to 8 chars, as is, with any padding, as their cast8.
+// Compare with the cast8 of a literal, that is constexpr
+struct alpha {
+    typedef uint64_t value_type;
+
+    template<uint32_t W>
+    static constexpr value_type parse(const char* s) {
+        static_assert(W >= 1 && W <= 8);
+        return cast8(s, W);
+    }
+
+    template<uint32_t W>
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        _parse_each<alpha, W>(base, stride, out, n);
+    }
+};
+
+//// Records
+
+// Field of Width chars, at Offset in the record, parsed as Type
+template<uint32_t Offset, uint32_t Width, typename Type>
+struct field {
+    typedef typename Type::value_type value_type;
+    static constexpr uint32_t offset = Offset;
+    static constexpr uint32_t width = Width;
+
+    static constexpr value_type parse(const char* rec) {
+        return Type::template parse<Width>(rec + Offset);
+    }
+
+    // The field of n records, at base, base + stride, etc.
+    static void parse_batch(const char* base, size_t stride, value_type* out, size_t n) {
+        Type::template parse_batch<Width>(base + Offset, stride, out, n);
+    }
+};
+
+// Record of Fields, each a field<Offset, Width, Type>
+template<typename... Fields>
+struct record {
+    // Parsed fields, in order
+    typedef std::tuple<typename Fields::value_type...> values;
+
+    // Output arrays, one per field, for parse_batch
+    typedef std::tuple<typename Fields::value_type*...> columns;
+
+    // Number of fields
+    static constexpr uint32_t count = sizeof...(Fields);
+
+    // Length of the record, to the end of the last field
+    static constexpr uint32_t size = std::max({ (Fields::offset + Fields::width)... });
+
+    // Parse field I of the record at rec
+    template<size_t I>
+    static constexpr auto get(const char* rec) {
+        return std::tuple_element_t<I, std::tuple<Fields...>>::parse(rec);
+    }
+
+    // Parse all fields of the record at rec
+    static constexpr values parse(const char* rec) {
+        return values(Fields::parse(rec)...);
+    }
+
+    // Parse n records, at base, base + stride, etc., to an array per field.
+    // Field by field, so numbers of up to 8, or 20, digits are parsed a
+    // few at a time with atou8_batch and atou_batch. A null array skips
+    // the field
+    static void parse_batch(const char* base, size_t stride, size_t n, const columns& out) {
+        _parse_batch(base, stride, n, out, std::index_sequence_for<Fields...>());
+    }
+
+private:
+    template<size_t... I>
+    static void _parse_batch(const char* base, size_t stride, size_t n, const columns& out,
+                             std::index_sequence<I...>) {
+        ((std::get<I>(out) ? Fields::parse_batch(base, stride, std::get<I>(out), n) : void()), ...);
+    }
+};
+
+} // namespace swar
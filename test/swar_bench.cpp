@@ -1,11 +1,22 @@
 #include "../swar.h"
+#include "../swar_fix.h"
+#include "../swar_map.h"
+#include "../swar_record.h"
 
 #include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <time.h>
 
 #include <string>
 #include <random>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
 
 inline int64_t rdtsc() {
     union {
@@ -17,7 +28,7 @@ inline int64_t rdtsc() {
     return u.ts;
 }
 
-inline naive_atoull(const char* p, int n) {
+inline uint64_t naive_atoull(const char* p, int n) {
     uint64_t ret = 0;
     for (int i = 0; i < n; i++)
         ret = ret * 10 + p[i] - '0';
@@ -32,22 +43,8 @@ void acc(uint64_t& dst, uint64_t src)
         dst = src;
 }
 
-int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
-
-    int test_size = 10000;
-    int test_repetitions = 10;
-
-    for (int i = 1; i < argc; i++) {
-        if (strcmp(argv[i], "-n") == 0) {
-            test_size = atoi(argv[++i]);
-        }
-        else if (strcmp(argv[i], "-r") == 0) {
-            test_repetitions = atoi(argv[++i]);
-        }
-    }
-
+// Comparison of atoi implementations
+void bench_atou(int test_size, int test_repetitions) {
     // Generate a long string of random numbers for atoi
     std::vector<std::vector<char>> v(21);
     std::mt19937_64 mt(rdtsc());
@@ -71,6 +68,7 @@ int main(int argc, char* argv[]) {
     std::vector<uint64_t> dt_swarX(21);
     std::vector<uint64_t> dt_swar8(21);
     std::vector<uint64_t> dt_swar4(21);
+    std::vector<uint64_t> dt_parse(21);
 
     for (int r = 0; r < test_repetitions; r++) {
         for (int len = 1; len < 21; len++) {
@@ -126,19 +124,30 @@ int main(int argc, char* argv[]) {
                 total_len += len + 1;
             }
 
+            // Test swar parse_uint, that finds the length too
             uint64_t t6 = rdtsc();
+            total_len = 0;
+            for (int i = 0; i < test_size; i++ ) {
+                uint64_t x = 0;
+                swar::parse_uint(buf + total_len, buf + total_len + len + 1, x);
+                junk += x;
+                total_len += len + 1;
+            }
+
+            uint64_t t7 = rdtsc();
             acc(dt_no_op[len], t1 - t0);
             acc(dt_stock[len], t2 - t1);
             acc(dt_naive[len], t3 - t2);
             acc(dt_swar_[len], t4 - t3);
             acc(dt_swar8[len], t5 - t4);
             acc(dt_swar4[len], t6 - t5);
+            acc(dt_parse[len], t7 - t6);
         }
     }
 
     printf("%d%c", uint32_t(junk) % 10, 8);
-    printf("len %7s %7s %7s %7s %7s\n",
-           "stock", "naive", "swar", "swar8", "swar4");
+    printf("len %7s %7s %7s %7s %7s %7s\n",
+           "stock", "naive", "swar", "swar8", "swar4", "parse");
     double f = 1.0 / test_size;
     for (int len = 1; len < 21; len++) {
         double tf_stock = (dt_stock[len] - dt_no_op[len]) * f;
@@ -146,10 +155,1106 @@ int main(int argc, char* argv[]) {
         double tf_swar_ = (dt_swar_[len] - dt_no_op[len]) * f;
         double tf_swar8 = (dt_swar8[len] - dt_no_op[len]) * f;
         double tf_swar4 = (dt_swar4[len] - dt_no_op[len]) * f;
-        printf("%3d %7.1f %7.1f %7.1f %7.1f %7.1f\n",
-               len, tf_stock, tf_naive, tf_swar_, tf_swar8, tf_swar4);
+        double tf_parse = (dt_parse[len] - dt_no_op[len]) * f;
+        printf("%3d %7.1f %7.1f %7.1f %7.1f %7.1f %7.1f\n",
+               len, tf_stock, tf_naive, tf_swar_, tf_swar8, tf_swar4, tf_parse);
+    }
+}
+
+// Cost of the checked parsers over the unchecked ones, cycles per call
+void bench_checked(int test_size, int test_repetitions) {
+    std::vector<std::vector<char>> v(21);
+    std::mt19937_64 mt(rdtsc());
+    uint64_t mask = 1;
+    for (int len = 1; len < 21; len++) {
+        v[len].resize(test_size * (len + 1) + 8);
+        mask *= 10;
+        int total_len = 0;
+        char* buf = v[len].data();
+        for (int i = 1; i < test_size; i++) {
+            sprintf(buf + total_len, "%0*lu", len, mt() % mask);
+            total_len += len + 1;
+        }
+    }
+
+    uint64_t junk = 0;
+    std::vector<uint64_t> dt_no_op(21);
+    std::vector<uint64_t> dt_atou8(21);
+    std::vector<uint64_t> dt_chek8(21);
+    std::vector<uint64_t> dt_atou_(21);
+    std::vector<uint64_t> dt_chek_(21);
+
+    for (int r = 0; r < test_repetitions; r++) {
+        for (int len = 1; len < 21; len++) {
+            char* buf = v[len].data();
+            int len8 = len <= 8 ? len : 8;
+
+            uint64_t t0 = rdtsc();
+            int total_len = 0;
+            for (int i = 0; i < test_size; i++ ) {
+                junk += buf[total_len];
+                total_len += len + 1;
+            }
+
+            uint64_t t1 = rdtsc();
+            total_len = 0;
+            for (int i = 0; i < test_size; i++ ) {
+                junk += swar::atou8(buf + total_len, len8);
+                total_len += len + 1;
+            }
+
+            uint64_t t2 = rdtsc();
+            total_len = 0;
+            for (int i = 0; i < test_size; i++ ) {
+                uint32_t x = 0;
+                junk += swar::atou8_checked(buf + total_len, len8, x);
+                junk += x;
+                total_len += len + 1;
+            }
+
+            uint64_t t3 = rdtsc();
+            total_len = 0;
+            for (int i = 0; i < test_size; i++ ) {
+                junk += swar::atou(buf + total_len, len);
+                total_len += len + 1;
+            }
+
+            uint64_t t4 = rdtsc();
+            total_len = 0;
+            for (int i = 0; i < test_size; i++ ) {
+                uint64_t x = 0;
+                junk += swar::atou_checked(buf + total_len, len, x);
+                junk += x;
+                total_len += len + 1;
+            }
+
+            uint64_t t5 = rdtsc();
+            acc(dt_no_op[len], t1 - t0);
+            acc(dt_atou8[len], t2 - t1);
+            acc(dt_chek8[len], t3 - t2);
+            acc(dt_atou_[len], t4 - t3);
+            acc(dt_chek_[len], t5 - t4);
+        }
+    }
+
+    printf("%d%c", uint32_t(junk) % 10, 8);
+    printf("len %7s %7s %7s %7s\n", "atou8", "checked", "atou", "checked");
+    double f = 1.0 / test_size;
+    for (int len = 1; len < 21; len++) {
+        printf("%3d %7.1f %7.1f %7.1f %7.1f\n", len,
+               (dt_atou8[len] - dt_no_op[len]) * f,
+               (dt_chek8[len] - dt_no_op[len]) * f,
+               (dt_atou_[len] - dt_no_op[len]) * f,
+               (dt_chek_[len] - dt_no_op[len]) * f);
+    }
+}
+
+// Comparison of atod with strtod, cycles per call.
+// Prices with a few decimals, and any double in 17 digits
+void bench_atod(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    const char* names[] = { "price", "price long", "%.17g" };
+    std::vector<std::string> v[3];
+    for (int i = 0; i < test_size; i++) {
+        char buf[64];
+        sprintf(buf, "%.2f", (mt() % 10000000) / 100.0);
+        v[0].push_back(buf);
+        sprintf(buf, "%.8f", (mt() % 100000000000000ull) / 1e8);
+        v[1].push_back(buf);
+        uint64_t bits = mt() % 0x7ff0000000000000ull;
+        double d;
+        memcpy(&d, &bits, 8);
+        sprintf(buf, "%.17g", d);
+        v[2].push_back(buf);
+    }
+
+    // fixed is atofixed<8>, that never goes through double
+    double junk = 0;
+    printf("%-12s %7s %7s %7s\n", "atod", "strtod", "swar", "fixed");
+    for (int m = 0; m < 3; m++) {
+        uint64_t dt_stock = 0;
+        uint64_t dt_swar = 0;
+        uint64_t dt_fixed = 0;
+        for (int r = 0; r < test_repetitions; r++) {
+            uint64_t t0 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += strtod(v[m][i].c_str(), nullptr);
+            uint64_t t1 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += swar::atod(v[m][i].data(), v[m][i].size());
+            uint64_t t2 = rdtsc();
+            for (int i = 0; i < test_size && m < 2; i++)
+                junk += swar::atofixed<8>(v[m][i].data(), v[m][i].size());
+            uint64_t t3 = rdtsc();
+            acc(dt_stock, t1 - t0);
+            acc(dt_swar, t2 - t1);
+            acc(dt_fixed, t3 - t2);
+        }
+        double f = 1.0 / test_size;
+        printf("%-12s %7.1f %7.1f %7.1f\n", names[m], dt_stock * f, dt_swar * f,
+               m < 2 ? dt_fixed * f : 0.0);
+    }
+    printf("%d%c", (int)junk % 10, 8);
+}
+
+// Comparison of itoa implementations, cycles per call, by length
+void bench_itoa(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    std::vector<std::vector<uint64_t>> v(21);
+    uint64_t lo = 1;
+    for (int len = 1; len < 21; len++) {
+        // len digits exactly
+        uint64_t hi = len < 20 ? lo * 10 : 0;
+        for (int i = 0; i < test_size; i++)
+            v[len].push_back(len == 1 ? mt() % 10 : lo + mt() % (hi - lo));
+        lo *= 10;
+    }
+
+    uint64_t junk = 0;
+    char buf[32];
+    printf("len %7s %7s\n", "stock", "swar");
+    for (int len = 1; len < 21; len++) {
+        uint64_t dt_stock = 0;
+        uint64_t dt_swar = 0;
+        for (int r = 0; r < test_repetitions; r++) {
+            uint64_t t0 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += sprintf(buf, "%lu", v[len][i]);
+            uint64_t t1 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += swar::utoa(v[len][i], buf);
+            uint64_t t2 = rdtsc();
+            acc(dt_stock, t1 - t0);
+            acc(dt_swar, t2 - t1);
+        }
+        double f = 1.0 / test_size;
+        printf("%3d %7.1f %7.1f\n", len, dt_stock * f, dt_swar * f);
     }
 
+    // Zero padded, fixed width, like FIX SeqNum and OrderID
+    printf("\npadded %7s %7s\n", "stock", "swar");
+    uint64_t dt[4][2] = {};
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += sprintf(buf, "%08lu", v[8][i]);
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::utoap<8>(v[8][i], buf)[7];
+        uint64_t t2 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += sprintf(buf, "%016lu", v[16][i]);
+        uint64_t t3 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::utoap<16>(v[16][i], buf)[15];
+        uint64_t t4 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += sprintf(buf, "%018lu", v[18][i]);
+        uint64_t t5 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::utoap<18>(v[18][i], buf)[17];
+        uint64_t t6 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += sprintf(buf, "%020lu", v[20][i]);
+        uint64_t t7 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::utoap<20>(v[20][i], buf)[19];
+        uint64_t t8 = rdtsc();
+        acc(dt[0][0], t1 - t0);
+        acc(dt[0][1], t2 - t1);
+        acc(dt[1][0], t3 - t2);
+        acc(dt[1][1], t4 - t3);
+        acc(dt[2][0], t5 - t4);
+        acc(dt[2][1], t6 - t5);
+        acc(dt[3][0], t7 - t6);
+        acc(dt[3][1], t8 - t7);
+    }
+    double f = 1.0 / test_size;
+    const int widths[4] = { 8, 16, 18, 20 };
+    for (int i = 0; i < 4; i++)
+        printf("%6d %7.1f %7.1f\n", widths[i], dt[i][0] * f, dt[i][1] * f);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of 128 bit parse and format with a digit at a time loop,
+// cycles per call, on 25 and 39 digit numbers
+void bench_int128(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    printf("%-8s %7s %7s %7s %7s\n", "digits", "atou", "swar", "utoa", "swar");
+    uint64_t junk = 0;
+    for (uint32_t digits : { 25, 39 }) {
+        std::vector<unsigned __int128> v(test_size);
+        std::vector<std::string> s(test_size);
+        for (int i = 0; i < test_size; i++) {
+            // Random digits, below 2^128 for 39
+            std::string d(digits, '0');
+            for (uint32_t j = 0; j < digits; j++)
+                d[j] = '0' + mt() % (j == 0 && digits == 39 ? 4 : 10);
+            s[i] = d + std::string(8, '\0');
+            v[i] = swar::atou128(s[i].data(), digits);
+        }
+
+        char buf[48];
+        uint64_t dt[4] = {};
+        for (int r = 0; r < test_repetitions; r++) {
+            uint64_t t0 = rdtsc();
+            for (int i = 0; i < test_size; i++) {
+                unsigned __int128 x = 0;
+                for (uint32_t j = 0; j < digits; j++)
+                    x = x * 10 + (s[i][j] - '0');
+                junk += (uint64_t)x;
+            }
+            uint64_t t1 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += (uint64_t)swar::atou128(s[i].data(), digits);
+            uint64_t t2 = rdtsc();
+            for (int i = 0; i < test_size; i++) {
+                unsigned __int128 x = v[i];
+                char* p = buf + 47;
+                *p = 0;
+                do {
+                    *--p = '0' + (int)(x % 10);
+                    x /= 10;
+                } while (x);
+                junk += buf[46];
+            }
+            uint64_t t3 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += swar::utoa128(v[i], buf);
+            uint64_t t4 = rdtsc();
+            acc(dt[0], t1 - t0);
+            acc(dt[1], t2 - t1);
+            acc(dt[2], t3 - t2);
+            acc(dt[3], t4 - t3);
+        }
+        double f = 1.0 / test_size;
+        printf("%-8u %7.1f %7.1f %7.1f %7.1f\n", digits, dt[0] * f, dt[1] * f, dt[2] * f, dt[3] * f);
+    }
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of hex formatting with snprintf, cycles per call, and per
+// 1500 byte packet for hexdump
+void bench_hex(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    std::vector<uint64_t> v(test_size);
+    for (int i = 0; i < test_size; i++)
+        v[i] = mt() >> (mt() % 64);
+    std::vector<char> pkt(1500);
+    for (char& c : pkt)
+        c = mt();
+
+    uint64_t junk = 0;
+    char buf[32];
+    std::vector<char> out(80 * (1500 / 16 + 1) + 1);
+    uint64_t dt[6] = {};
+    int npkts = test_size / 100 + 1;
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += snprintf(buf, sizeof(buf), "%lx", v[i]);
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::utoh(v[i], buf);
+        uint64_t t2 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += snprintf(buf, sizeof(buf), "%016lx", v[i]);
+        uint64_t t3 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::utohp(v[i], buf)[15];
+        uint64_t t4 = rdtsc();
+        for (int i = 0; i < npkts; i++) {
+            // hexdump -C with snprintf
+            char* d = out.data();
+            for (int j = 0; j < 1500; j += 16) {
+                d += sprintf(d, "%08x  ", j);
+                for (int k = 0; k < 16 && j + k < 1500; k++)
+                    d += sprintf(d, k == 7 ? "%02x  " : "%02x ", (uint8_t)pkt[j + k]);
+                *d++ = '|';
+                for (int k = 0; k < 16 && j + k < 1500; k++)
+                    *d++ = pkt[j + k] >= 0x20 && pkt[j + k] < 0x7f ? pkt[j + k] : '.';
+                *d++ = '|';
+                *d++ = '\n';
+            }
+            junk += d - out.data();
+        }
+        uint64_t t5 = rdtsc();
+        for (int i = 0; i < npkts; i++)
+            junk += swar::hexdump(pkt.data(), 1500, out.data());
+        uint64_t t6 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+        acc(dt[2], t3 - t2);
+        acc(dt[3], t4 - t3);
+        acc(dt[4], t5 - t4);
+        acc(dt[5], t6 - t5);
+    }
+    double f = 1.0 / test_size;
+    printf("%-8s %7s %7s\n", "", "stock", "swar");
+    printf("%-8s %7.1f %7.1f\n", "%lx", dt[0] * f, dt[1] * f);
+    printf("%-8s %7.1f %7.1f\n", "%016lx", dt[2] * f, dt[3] * f);
+    printf("%-8s %7.0f %7.0f\n", "hexdump", dt[4] / (double)npkts, dt[5] / (double)npkts);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of FIX timestamps with strptime and strftime, cycles per call
+void bench_time(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    std::vector<int64_t> ns(test_size);
+    std::vector<std::string> ts(test_size);
+    char buf[64];
+    for (int i = 0; i < test_size; i++) {
+        // 2000 to 2030, in microseconds
+        ns[i] = (946684800000000ll + mt() % 946684800000000ll) * 1000;
+        swar::format_timestamp<6>(ns[i], buf);
+        ts[i] = std::string(buf, 24).append(8, '\0');
+    }
+
+    uint64_t junk = 0;
+    uint64_t dt[4] = {};
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            struct tm tm = {};
+            const char* p = strptime(ts[i].c_str(), "%Y%m%d-%H:%M:%S", &tm);
+            junk += timegm(&tm) * 1000000000ll + atoi(p + 1) * 1000ll;
+        }
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::parse_timestamp(ts[i].data(), 24);
+        uint64_t t2 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            time_t t = ns[i] / 1000000000;
+            struct tm tm;
+            gmtime_r(&t, &tm);
+            size_t n = strftime(buf, sizeof(buf), "%Y%m%d-%H:%M:%S", &tm);
+            junk += snprintf(buf + n, sizeof(buf) - n, ".%06ld", ns[i] % 1000000000 / 1000);
+        }
+        uint64_t t3 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::format_timestamp<6>(ns[i], buf);
+        uint64_t t4 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+        acc(dt[2], t3 - t2);
+        acc(dt[3], t4 - t3);
+    }
+    double f = 1.0 / test_size;
+    printf("%-8s %7s %7s\n", "", "stock", "swar");
+    printf("%-8s %7.1f %7.1f\n", "parse", dt[0] * f, dt[1] * f);
+    printf("%-8s %7.1f %7.1f\n", "format", dt[2] * f, dt[3] * f);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of case conversion and compare with the per-byte libc
+// functions, cycles per call, on symbol length strings
+void bench_case(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    const uint32_t len = 12;
+    std::vector<std::string> a(test_size), b(test_size);
+    for (int i = 0; i < test_size; i++) {
+        for (uint32_t j = 0; j < len; j++) {
+            char c = 'a' + mt() % 26;
+            a[i] += mt() % 2 ? c - 32 : c;
+            b[i] += mt() % 2 ? c - 32 : c;
+        }
+        a[i].append(8, '\0');
+        b[i].append(8, '\0');
+    }
+
+    uint64_t junk = 0;
+    char buf[32];
+    uint64_t dt[4] = {};
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            for (uint32_t j = 0; j < len; j++)
+                buf[j] = ::tolower(a[i][j]);
+            junk += buf[i % len];
+        }
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            swar::tolower(a[i].data(), len, buf);
+            junk += buf[i % len];
+        }
+        uint64_t t2 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += strncasecmp(a[i].data(), b[i].data(), len) == 0;
+        uint64_t t3 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::eq_ci(a[i].data(), b[i].data(), len);
+        uint64_t t4 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+        acc(dt[2], t3 - t2);
+        acc(dt[3], t4 - t3);
+    }
+    double f = 1.0 / test_size;
+    printf("%-8s %7s %7s\n", "", "stock", "swar");
+    printf("%-8s %7.1f %7.1f\n", "tolower", dt[0] * f, dt[1] * f);
+    printf("%-8s %7.1f %7.1f\n", "eq_ci", dt[2] * f, dt[3] * f);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of short string equality and ordering with memcmp, cycles per
+// call, on random symbols of 1 to 16 chars, half of them equal
+void bench_cmp(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    std::vector<std::string> a(test_size), b(test_size);
+    std::vector<uint32_t> alen(test_size), blen(test_size);
+    for (int i = 0; i < test_size; i++) {
+        alen[i] = 1 + mt() % 16;
+        for (uint32_t j = 0; j < alen[i]; j++)
+            a[i] += 'A' + mt() % 26;
+        b[i] = a[i];
+        if (mt() % 2)
+            b[i][mt() % alen[i]] = 'A' + mt() % 26;
+        blen[i] = alen[i];
+        a[i].append(16, '\0');
+        b[i].append(16, '\0');
+    }
+
+    uint64_t junk = 0;
+    uint64_t dt[4] = {};
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += memcmp(a[i].data(), b[i].data(), alen[i]) == 0;
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::eq16(a[i].data(), b[i].data(), alen[i]);
+        uint64_t t2 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            int c = memcmp(a[i].data(), b[i].data(), std::min(alen[i], blen[i]));
+            junk += c ? c : (alen[i] > blen[i]) - (alen[i] < blen[i]);
+        }
+        uint64_t t3 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::cmp16(a[i].data(), alen[i], b[i].data(), blen[i]);
+        uint64_t t4 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+        acc(dt[2], t3 - t2);
+        acc(dt[3], t4 - t3);
+    }
+    double f = 1.0 / test_size;
+    printf("%-8s %7s %7s\n", "", "memcmp", "swar");
+    printf("%-8s %7.1f %7.1f\n", "eq16", dt[0] * f, dt[1] * f);
+    printf("%-8s %7.1f %7.1f\n", "cmp16", dt[2] * f, dt[3] * f);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of short_string_map with unordered_map, cycles per lookup of
+// a random present symbol of 1 to 16 chars, by the number of keys
+void bench_map(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    uint64_t junk = 0;
+    printf("%-8s %7s %7s\n", "keys", "stock", "swar");
+    for (uint32_t n : { 10000, 100000, 1000000 }) {
+        swar::short_string_map<uint32_t> m(n);
+        std::unordered_map<std::string, uint32_t> um(n);
+        std::vector<std::string> keys;
+        while (keys.size() < n) {
+            std::string k;
+            uint32_t len = 1 + mt() % 16;
+            for (uint32_t j = 0; j < len; j++)
+                k += "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.-"[mt() % 38];
+            std::string pk = k + std::string(16, '\0');
+            if (m.insert(pk.data(), len, keys.size()).second) {
+                um.emplace(k, keys.size());
+                keys.push_back(k);
+            }
+        }
+
+        // Lookup keys, in random order, padded for the word reads
+        std::vector<std::string> lookup(test_size);
+        std::vector<std::string> plookup(test_size);
+        for (int i = 0; i < test_size; i++) {
+            lookup[i] = keys[mt() % n];
+            plookup[i] = lookup[i] + std::string(16, '\0');
+        }
+
+        uint64_t dt[2] = {};
+        for (int r = 0; r < test_repetitions; r++) {
+            uint64_t t0 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += um.find(lookup[i])->second;
+            uint64_t t1 = rdtsc();
+            for (int i = 0; i < test_size; i++)
+                junk += *m.find(plookup[i].data(), lookup[i].size());
+            uint64_t t2 = rdtsc();
+            acc(dt[0], t1 - t0);
+            acc(dt[1], t2 - t1);
+        }
+        double f = 1.0 / test_size;
+        printf("%-8u %7.1f %7.1f\n", n, dt[0] * f, dt[1] * f);
+    }
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of keyword_map with a strcmp chain, cycles per lookup of a
+// random FIX MsgType(35) value, 1 in 8 of them not a keyword
+void bench_keyword(int test_size, int test_repetitions) {
+    static const char* words[] = { "0", "1", "2", "3", "4", "5", "A", "D",
+        "F", "G", "8", "9", "V", "W", "X", "AE" };
+    static constexpr swar::keyword_map<int, 16> types({
+        { "0", 1 }, { "1", 2 }, { "2", 3 }, { "3", 4 }, { "4", 5 }, { "5", 6 },
+        { "A", 7 }, { "D", 8 }, { "F", 9 }, { "G", 10 }, { "8", 11 },
+        { "9", 12 }, { "V", 13 }, { "W", 14 }, { "X", 15 }, { "AE", 16 } }, 0);
+
+    std::mt19937_64 mt(rdtsc());
+    std::vector<std::string> values(test_size);
+    for (int i = 0; i < test_size; i++) {
+        values[i] = mt() % 8 ? words[mt() % 16] : "AZ";
+        values[i].append(8, '\0');
+    }
+
+    uint64_t junk = 0;
+    uint64_t dt[2] = {};
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            int t = 0;
+            for (int j = 0; j < 16; j++) {
+                if (strcmp(values[i].c_str(), words[j]) == 0) {
+                    t = j + 1;
+                    break;
+                }
+            }
+            junk += t;
+        }
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += types.find(values[i].data(), swar::strlen8(values[i].data()));
+        uint64_t t2 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+    }
+    double f = 1.0 / test_size;
+    printf("%-8s %7s %7s\n", "", "strcmp", "swar");
+    printf("%-8s %7.1f %7.1f\n", "msgtype", dt[0] * f, dt[1] * f);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of record parsing with strtoull and strtod per field, cycles
+// per record, a record at a time and a column at a time
+void bench_record(int test_size, int test_repetitions) {
+    typedef swar::record<
+        swar::field<0, 8, swar::u32>,
+        swar::field<8, 12, swar::fixed<4>>,
+        swar::field<20, 6, swar::alpha>,
+        swar::field<26, 16, swar::u64>
+    > rec;
+    const size_t stride = rec::size;
+
+    std::mt19937_64 mt(rdtsc());
+    std::string buf;
+    for (int i = 0; i < test_size; i++) {
+        char line[64];
+        snprintf(line, sizeof(line), "%8u%012.4f%-6s%16llu", (uint32_t)(mt() % 100000000),
+                 (mt() % 10000000000ull) / 10000.0, "IBM", (unsigned long long)(mt() % 10000000000000000ull));
+        buf += line;
+    }
+    buf.append(16, '\0');
+
+    std::vector<uint32_t> a(test_size);
+    std::vector<int64_t> price(test_size);
+    std::vector<uint64_t> sym(test_size), d(test_size);
+    uint64_t junk = 0;
+    uint64_t dt[3] = {};
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            const char* p = buf.data() + i * stride;
+            char tmp[24];
+            memcpy(tmp, p, 8);
+            tmp[8] = 0;
+            junk += strtoull(tmp, nullptr, 10);
+            memcpy(tmp, p + 8, 12);
+            tmp[12] = 0;
+            junk += (int64_t)llround(strtod(tmp, nullptr) * 10000);
+            memcpy(tmp, p + 20, 6);
+            junk += tmp[0];
+            memcpy(tmp, p + 26, 16);
+            tmp[16] = 0;
+            junk += strtoull(tmp, nullptr, 10);
+        }
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++) {
+            rec::values v = rec::parse(buf.data() + i * stride);
+            junk += std::get<0>(v) + std::get<1>(v) + std::get<2>(v) + std::get<3>(v);
+        }
+        uint64_t t2 = rdtsc();
+        rec::parse_batch(buf.data(), stride, test_size,
+                         rec::columns(a.data(), price.data(), sym.data(), d.data()));
+        junk += a[r % test_size] + price[r % test_size] + d[r % test_size];
+        uint64_t t3 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+        acc(dt[2], t3 - t2);
+    }
+    double f = 1.0 / test_size;
+    printf("%-8s %7s %7s %7s\n", "", "stock", "parse", "batch");
+    printf("%-8s %7.1f %7.1f %7.1f\n", "record", dt[0] * f, dt[1] * f, dt[2] * f);
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Comparison of dtoa with snprintf, cycles per call
+void bench_dtoa(int test_size, int test_repetitions) {
+    std::mt19937_64 mt(rdtsc());
+    std::vector<double> prices(test_size);
+    std::vector<double> any(test_size);
+    std::vector<int64_t> ticks(test_size);
+    for (int i = 0; i < test_size; i++) {
+        ticks[i] = mt() % 10000000000ull;
+        prices[i] = ticks[i] / 1e6;
+        uint64_t bits = mt() % 0x7ff0000000000000ull;
+        memcpy(&any[i], &bits, 8);
+    }
+
+    uint64_t junk = 0;
+    uint64_t dt[7] = {};
+    char buf[512];
+    for (int r = 0; r < test_repetitions; r++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += snprintf(buf, sizeof(buf), "%.8f", prices[i]);
+        uint64_t t1 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::dtoa<8>(prices[i], buf);
+        uint64_t t2 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += snprintf(buf, sizeof(buf), "%.17g", prices[i]);
+        uint64_t t3 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::dtoa(prices[i], buf);
+        uint64_t t4 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += snprintf(buf, sizeof(buf), "%.17g", any[i]);
+        uint64_t t5 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::dtoa(any[i], buf);
+        uint64_t t6 = rdtsc();
+        for (int i = 0; i < test_size; i++)
+            junk += swar::fixedtoa<8>(ticks[i] * 100, buf);
+        uint64_t t7 = rdtsc();
+        acc(dt[0], t1 - t0);
+        acc(dt[1], t2 - t1);
+        acc(dt[2], t3 - t2);
+        acc(dt[3], t4 - t3);
+        acc(dt[4], t5 - t4);
+        acc(dt[5], t6 - t5);
+        acc(dt[6], t7 - t6);
+    }
+
+    printf("%d%c", uint32_t(junk) % 10, 8);
+    double f = 1.0 / test_size;
+    printf("%-22s %7s %7s\n", "dtoa", "printf", "swar");
+    printf("%-22s %7.1f %7.1f\n", "price %.8f, dtoa<8>", dt[0] * f, dt[1] * f);
+    printf("%-22s %7.1f %7.1f\n", "price shortest", dt[2] * f, dt[3] * f);
+    printf("%-22s %7.1f %7.1f\n", "any shortest", dt[4] * f, dt[5] * f);
+    printf("%-22s %7s %7.1f\n", "ticks fixedtoa<8>", "", dt[6] * f);
+}
+
+// Comparison of batch atou with a loop of atou8/atou, in million values
+// per second. Fixed width columns, like end of day files
+void bench_batch(int test_size, int test_repetitions) {
+    typedef std::chrono::steady_clock clock;
+
+    std::mt19937_64 mt(rdtsc());
+    std::vector<uint32_t> out8(test_size);
+    std::vector<uint64_t> out(test_size);
+    uint64_t junk = 0;
+
+    printf("batch atou, million values per second\n%3s %7s %7s %7s %7s\n",
+           "len", "atou8", "batch8", "atou", "batch");
+    for (uint32_t len = 1; len <= 20; len++) {
+        // Columns of len digits and a separator. Padded for the over-read
+        size_t stride = len + 1;
+        std::vector<char> v(test_size * stride + 16, '|');
+        for (int i = 0; i < test_size; i++)
+            for (uint32_t j = 0; j < len; j++)
+                v[i * stride + j] = '0' + mt() % 10;
+        const char* buf = v.data();
+        uint32_t len8 = len <= 8 ? len : 8;
+
+        double dt[4] = { 1e9, 1e9, 1e9, 1e9 };
+        for (int r = 0; r < test_repetitions; r++) {
+            clock::time_point t0 = clock::now();
+            for (int i = 0; i < test_size; i++)
+                out8[i] = swar::atou8(buf + i * stride, len8);
+            clock::time_point t1 = clock::now();
+            swar::atou8_batch(buf, stride, len8, out8.data(), test_size);
+            clock::time_point t2 = clock::now();
+            for (int i = 0; i < test_size; i++)
+                out[i] = swar::atou(buf + i * stride, len);
+            clock::time_point t3 = clock::now();
+            swar::atou_batch(buf, stride, len, out.data(), test_size);
+            clock::time_point t4 = clock::now();
+
+            junk += out8[r % test_size] + out[r % test_size];
+            dt[0] = std::min(dt[0], std::chrono::duration<double>(t1 - t0).count());
+            dt[1] = std::min(dt[1], std::chrono::duration<double>(t2 - t1).count());
+            dt[2] = std::min(dt[2], std::chrono::duration<double>(t3 - t2).count());
+            dt[3] = std::min(dt[3], std::chrono::duration<double>(t4 - t3).count());
+        }
+
+        double f = test_size * 1e-6;
+        printf("%3u %7.0f %7.0f %7.0f %7.0f\n",
+               len, f / dt[0], f / dt[1], f / dt[2], f / dt[3]);
+    }
+    printf("%d%c", uint32_t(junk) % 10, 8);
+}
+
+// Scalar only busy loop. Long enough for the cpu to drop the wide vector
+// P-state, so the next vector instruction pays for switching back
+uint64_t spin(uint64_t cycles) {
+    uint64_t x = 0;
+    uint64_t t0 = rdtsc();
+    while (rdtsc() - t0 < cycles) {
+        asm volatile("" : "+r"(x));
+        x++;
+    }
+    return x;
+}
+
+typedef uint32_t (*memchr_fn)(const char*, uint32_t, uint8_t);
+
+uint32_t stock_memchr(const char* s, uint32_t len, uint8_t c) {
+    const void* p = ::memchr(s, c, len);
+    return p ? (const char*)p - s : -1;
+}
+
+// Comparison of memchr implementations, on FIX-like lengths.
+// warm - back to back calls, cycles per call
+// cold - one call after idle_cycles of scalar only code. This is where
+//        the P-state switch, if any, shows
+void bench_memchr(int test_size, int test_repetitions, uint64_t idle_cycles) {
+    const int nlens = 8;
+    const uint32_t lens[nlens] = { 16, 32, 64, 128, 256, 512, 1024, 4096 };
+
+    const char* names[] = { "stock", "swar", "aligned", "sse2", "avx2", "swar::", "padded" };
+    memchr_fn fns[] = {
+        stock_memchr,
+        swar::_memchr<false, false>,
+        swar::_memchr<false, false, true>,
+        swar::_memchr16<false>,
+        swar::_memchr32<false>,
+        swar::memchr,
+        [](const char* s, uint32_t len, uint8_t c) {
+            return swar::memchr(swar::padded_view(s, len), c);
+        },
+    };
+    const int nfns = sizeof(fns) / sizeof(fns[0]);
+    bool has_avx2 = __builtin_cpu_supports("avx2");
+
+    // Needle is the last byte. Buffer is padded for the word reads
+    std::vector<char> v(4096 + swar::padding, 'a');
+    char* buf = v.data();
+
+    uint64_t junk = 0;
+    std::vector<std::vector<uint64_t>> dt_warm(nfns, std::vector<uint64_t>(nlens));
+    std::vector<std::vector<uint64_t>> dt_cold(nfns, std::vector<uint64_t>(nlens));
+
+    for (int r = 0; r < test_repetitions; r++) {
+        for (int l = 0; l < nlens; l++) {
+            uint32_t len = lens[l];
+            buf[len - 1] = '=';
+            for (int f = 0; f < nfns; f++) {
+                if (f == 4 && !has_avx2)
+                    continue;
+
+                junk += spin(idle_cycles);
+                uint64_t t0 = rdtsc();
+                junk += fns[f](buf, len, '=');
+                uint64_t t1 = rdtsc();
+                for (int i = 0; i < test_size; i++) {
+                    junk += fns[f](buf, len, '=');
+                }
+                uint64_t t2 = rdtsc();
+
+                acc(dt_cold[f][l], t1 - t0);
+                acc(dt_warm[f][l], t2 - t1);
+            }
+            buf[len - 1] = 'a';
+        }
+    }
+
+    printf("%d%c", uint32_t(junk) % 10, 8);
+    printf("memchr warm, cycles per call\nlen ");
+    for (int f = 0; f < nfns; f++)
+        printf(" %7s", names[f]);
+    printf("\n");
+    double tf = 1.0 / test_size;
+    for (int l = 0; l < nlens; l++) {
+        printf("%4u", lens[l]);
+        for (int f = 0; f < nfns; f++)
+            printf(" %7.1f", dt_warm[f][l] * tf);
+        printf("\n");
+    }
+
+    printf("memchr cold, cycles of first call after %lu idle cycles\nlen ",
+           idle_cycles);
+    for (int f = 0; f < nfns; f++)
+        printf(" %7s", names[f]);
+    printf("\n");
+    for (int l = 0; l < nlens; l++) {
+        printf("%4u", lens[l]);
+        for (int f = 0; f < nfns; f++)
+            printf(" %7lu", dt_cold[f][l]);
+        printf("\n");
+    }
+}
+
+typedef uint32_t (*memmem_fn)(const char*, uint32_t, const char*, uint32_t);
+
+uint32_t stock_memmem(const char* s, uint32_t len, const char* n, uint32_t nlen) {
+    const void* p = ::memmem(s, len, n, nlen);
+    return p ? (const char*)p - s : -1;
+}
+
+// libc has no memrmem. memcmp at each position from the end
+uint32_t stock_memrmem(const char* s, uint32_t len, const char* n, uint32_t nlen) {
+    for (uint32_t i = len - nlen + 1; i-- > 0; )
+        if (memcmp(s + i, n, nlen) == 0)
+            return i;
+    return -1;
+}
+
+// Comparison of substring search for the FIX checksum field, that ends the
+// message, cycles per call. Every field start has the first and last chars
+// of "\x0110=", so from the start, that is the worst case for the filter
+void bench_memmem(int test_size, int test_repetitions) {
+    const int nlens = 4;
+    const uint32_t lens[nlens] = { 64, 256, 1500, 4096 };
+    const char* needle = "\x01" "10=";
+
+    const char* names[] = { "stock", "swar", "rstock", "rswar" };
+    memmem_fn fns[] = { stock_memmem, swar::memmem, stock_memrmem, swar::memrmem };
+    const int nfns = sizeof(fns) / sizeof(fns[0]);
+
+    // FIX-like fields, then the checksum. Padded for the word reads
+    std::string msg;
+    while (msg.size() < 4096)
+        msg += "49=SENDER\x01" "56=TARGET\x01" "35=D\x01" "44=123.45\x01";
+    std::vector<char> v(4096 + swar::padding);
+    char* buf = v.data();
+
+    uint64_t junk = 0;
+    std::vector<std::vector<uint64_t>> dt(nfns, std::vector<uint64_t>(nlens));
+    for (int r = 0; r < test_repetitions; r++) {
+        for (int l = 0; l < nlens; l++) {
+            uint32_t len = lens[l];
+            memcpy(buf, msg.data(), len - 7);
+            memcpy(buf + len - 7, "\x01" "10=123", 7);
+            for (int f = 0; f < nfns; f++) {
+                uint64_t t0 = rdtsc();
+                for (int i = 0; i < test_size; i++) {
+                    junk += fns[f](buf, len, needle, 4);
+                }
+                acc(dt[f][l], rdtsc() - t0);
+            }
+        }
+    }
+
+    printf("%d%c", uint32_t(junk) % 10, 8);
+    printf("memmem, cycles per call\nlen ");
+    for (int f = 0; f < nfns; f++)
+        printf(" %7s", names[f]);
+    printf("\n");
+    double tf = 1.0 / test_size;
+    for (int l = 0; l < nlens; l++) {
+        printf("%4u", lens[l]);
+        for (int f = 0; f < nfns; f++)
+            printf(" %7.1f", dt[f][l] * tf);
+        printf("\n");
+    }
+}
+
+// Naive FIX field loop, one byte at a time
+uint64_t naive_fix(const char* p, const char* end) {
+    uint64_t ret = 0;
+    while (p < end) {
+        uint32_t tag = 0;
+        while (*p != '=')
+            tag = tag * 10 + *p++ - '0';
+        const char* value = ++p;
+        while (*p != '\x01')
+            p++;
+        ret += tag + (p - value) + *value;
+        p++;
+    }
+    return ret;
+}
+
+// SWAR FIX field iterator
+uint64_t swar_fix(const char* p, const char* end) {
+    uint64_t ret = 0;
+    swar::fix::field_iterator it(p, end - p);
+    swar::fix::field f;
+    while (it.next(f)) {
+        ret += f.tag + f.len + *f.value;
+    }
+    return ret;
+}
+
+// SWAR FIX bitmap index iterator
+uint64_t swar_fix_index(const char* p, const char* end) {
+    uint64_t ret = 0;
+    swar::fix::index_iterator it(p, end - p);
+    swar::fix::field f;
+    while (it.next(f)) {
+        ret += f.tag + f.len + *f.value;
+    }
+    return ret;
+}
+
+// Comparison of FIX field parsing, cycles per message.
+// Value lengths are randomized over many copies of each message, so the
+// branch predictor can not learn a single message
+void bench_fix(int test_size, int test_repetitions) {
+    const char* names[] = { "NewOrderSingle", "ExecutionReport" };
+    const char* msgs[] = {
+        "8=FIX.4.4\x01" "9=178\x01" "35=D\x01" "34=1092\x01" "49=CLIENT01\x01"
+        "52=20240315-14:30:01.123456\x01" "56=BROKER\x01" "1=ACC-0012345\x01"
+        "11=ORD-20240315-0000123456\x01" "21=1\x01" "38=1500\x01" "40=2\x01"
+        "44=101.2500\x01" "54=1\x01" "55=MSFT\x01" "59=0\x01"
+        "60=20240315-14:30:01.123400\x01" "10=123\x01",
+
+        "8=FIX.4.4\x01" "9=289\x01" "35=8\x01" "34=2311\x01" "49=BROKER\x01"
+        "52=20240315-14:30:01.125789\x01" "56=CLIENT01\x01" "1=ACC-0012345\x01"
+        "6=101.2475\x01" "11=ORD-20240315-0000123456\x01" "14=500\x01"
+        "17=EXEC-98765432-0001\x01" "31=101.2475\x01" "32=500\x01" "37=BRK-7788990011\x01"
+        "38=1500\x01" "39=1\x01" "40=2\x01" "44=101.2500\x01" "54=1\x01" "55=MSFT\x01"
+        "59=0\x01" "60=20240315-14:30:01.125700\x01" "150=F\x01" "151=1000\x01"
+        "10=211\x01",
+    };
+    const int nmsgs = 2;
+    const int ncopies = 256;
+
+    // Copies of each message, with up to 5 chars cut from, or added to,
+    // the value of each field. Padded for the SWAR over-read
+    std::mt19937_64 mt(rdtsc());
+    std::vector<std::vector<char>> v(nmsgs);
+    std::vector<std::vector<uint32_t>> offs(nmsgs);
+    for (int m = 0; m < nmsgs; m++) {
+        for (int c = 0; c < ncopies; c++) {
+            offs[m].push_back(v[m].size());
+            for (const char* p = msgs[m]; *p; ) {
+                const char* eq = strchr(p, '=');
+                const char* soh = strchr(p, '\x01');
+                v[m].insert(v[m].end(), p, eq + 1);
+                int len = soh - eq - 1 + (int)(mt() % 11) - 5;
+                for (int i = 0; i < std::max(len, 1); i++)
+                    v[m].push_back(eq[1 + i % (soh - eq - 1)]);
+                v[m].push_back('\x01');
+                p = soh + 1;
+            }
+        }
+        offs[m].push_back(v[m].size());
+        v[m].resize(v[m].size() + 32);
+    }
+
+    uint64_t junk = 0;
+    std::vector<uint64_t> dt_naive(nmsgs);
+    std::vector<uint64_t> dt_swar(nmsgs);
+    std::vector<uint64_t> dt_index(nmsgs);
+
+    for (int r = 0; r < test_repetitions; r++) {
+        for (int m = 0; m < nmsgs; m++) {
+            const char* buf = v[m].data();
+            const uint32_t* o = offs[m].data();
+
+            uint64_t t0 = rdtsc();
+            for (int i = 0; i < test_size; i++) {
+                int c = i % ncopies;
+                junk += naive_fix(buf + o[c], buf + o[c + 1]);
+            }
+            uint64_t t1 = rdtsc();
+            for (int i = 0; i < test_size; i++) {
+                int c = i % ncopies;
+                junk += swar_fix(buf + o[c], buf + o[c + 1]);
+            }
+            uint64_t t2 = rdtsc();
+            for (int i = 0; i < test_size; i++) {
+                int c = i % ncopies;
+                junk += swar_fix_index(buf + o[c], buf + o[c + 1]);
+            }
+            uint64_t t3 = rdtsc();
+
+            acc(dt_naive[m], t1 - t0);
+            acc(dt_swar[m], t2 - t1);
+            acc(dt_index[m], t3 - t2);
+        }
+    }
+
+    printf("%d%c", uint32_t(junk) % 10, 8);
+    printf("fix fields, cycles per message\n%-16s %7s %7s %7s\n",
+           "msg", "naive", "swar", "index");
+    double tf = 1.0 / test_size;
+    for (int m = 0; m < nmsgs; m++) {
+        printf("%-16s %7.1f %7.1f %7.1f\n", names[m],
+               dt_naive[m] * tf, dt_swar[m] * tf, dt_index[m] * tf);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int test_size = 10000;
+    int test_repetitions = 10;
+    uint64_t idle_cycles = 10000000;
+    const char* bench = "all";
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0) {
+            test_size = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-r") == 0) {
+            test_repetitions = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-i") == 0) {
+            idle_cycles = atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-b") == 0) {
+            bench = argv[++i];
+        }
+    }
+
+    bool all = strcmp(bench, "all") == 0;
+    if (all || strcmp(bench, "atou") == 0)
+        bench_atou(test_size, test_repetitions);
+    if (all || strcmp(bench, "checked") == 0)
+        bench_checked(test_size, test_repetitions);
+    if (all || strcmp(bench, "atod") == 0)
+        bench_atod(test_size, test_repetitions);
+    if (all || strcmp(bench, "itoa") == 0)
+        bench_itoa(test_size, test_repetitions);
+    if (all || strcmp(bench, "int128") == 0)
+        bench_int128(test_size, test_repetitions);
+    if (all || strcmp(bench, "hex") == 0)
+        bench_hex(test_size, test_repetitions);
+    if (all || strcmp(bench, "time") == 0)
+        bench_time(test_size, test_repetitions);
+    if (all || strcmp(bench, "case") == 0)
+        bench_case(test_size, test_repetitions);
+    if (all || strcmp(bench, "cmp") == 0)
+        bench_cmp(test_size, test_repetitions);
+    if (all || strcmp(bench, "map") == 0)
+        bench_map(test_size, test_repetitions);
+    if (all || strcmp(bench, "keyword") == 0)
+        bench_keyword(test_size, test_repetitions);
+    if (all || strcmp(bench, "record") == 0)
+        bench_record(test_size, test_repetitions);
+    if (all || strcmp(bench, "dtoa") == 0)
+        bench_dtoa(test_size, test_repetitions);
+    if (all || strcmp(bench, "memchr") == 0)
+        bench_memchr(test_size, test_repetitions, idle_cycles);
+    if (all || strcmp(bench, "memmem") == 0)
+        bench_memmem(test_size, test_repetitions);
+    if (all || strcmp(bench, "fix") == 0)
+        bench_fix(test_size, test_repetitions);
+    if (all || strcmp(bench, "batch") == 0)
+        bench_batch(test_size, test_repetitions);
+
     return 0;
 }
 
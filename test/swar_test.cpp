@@ -1,34 +1,56 @@
 #include "../swar.h"
+#include "../swar_fix.h"
+#include "../swar_map.h"
+#include "../swar_record.h"
+#include <errno.h>
+#include <math.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
 #include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
 
+// Copy of s, with room for the whole word reads past the end
+static std::string padded(const char* s) {
+    return std::string(s).append(8, '\0');
+}
 
 TEST(r8, memchr) {
-    EXPECT_EQ(swar::memchr8("12345678=90", '='), -1);
-    EXPECT_EQ(swar::memchr8("1234567=890", '='), 7);
-    EXPECT_EQ(swar::memchr8("123456=7890", '='), 6);
-    EXPECT_EQ(swar::memchr8("12345=67890", '='), 5);
-    EXPECT_EQ(swar::memchr8("1234=567890", '='), 4);
-    EXPECT_EQ(swar::memchr8("123=4567890", '='), 3);
-    EXPECT_EQ(swar::memchr8("12=34567890", '='), 2);
-    EXPECT_EQ(swar::memchr8("1=234567890", '='), 1);
-    EXPECT_EQ(swar::memchr8("=1234567890", '='), 0);
-
-    EXPECT_EQ(swar::memchr8("1234=", '='), 4);
-    EXPECT_EQ(swar::memchr8("123=4", '='), 3);
-    EXPECT_EQ(swar::memchr8("12=34", '='), 2);
-    EXPECT_EQ(swar::memchr8("1=234", '='), 1);
-    EXPECT_EQ(swar::memchr8("=1234", '='), 0);
-
-    EXPECT_EQ(swar::memchr8("===", '='), 0);
-    EXPECT_EQ(swar::memchr8("==", '='), 0);
-    EXPECT_EQ(swar::memchr8("=", '='), 0);
-
-    //                    123456789 123456789 123456789 
-    EXPECT_EQ(swar::memchr("1234567890abcdefghij=", 20, '='), -1);
-    EXPECT_EQ(swar::memchr("12345678=90abcdefghi", 20, '='), 8);
-    EXPECT_EQ(swar::memchr("1234=567890abcdefghi", 20, '='), 4);
+    EXPECT_EQ(swar::memchr8(padded("12345678=90").data(), '='), -1);
+    EXPECT_EQ(swar::memchr8(padded("1234567=890").data(), '='), 7);
+    EXPECT_EQ(swar::memchr8(padded("123456=7890").data(), '='), 6);
+    EXPECT_EQ(swar::memchr8(padded("12345=67890").data(), '='), 5);
+    EXPECT_EQ(swar::memchr8(padded("1234=567890").data(), '='), 4);
+    EXPECT_EQ(swar::memchr8(padded("123=4567890").data(), '='), 3);
+    EXPECT_EQ(swar::memchr8(padded("12=34567890").data(), '='), 2);
+    EXPECT_EQ(swar::memchr8(padded("1=234567890").data(), '='), 1);
+    EXPECT_EQ(swar::memchr8(padded("=1234567890").data(), '='), 0);
+
+    EXPECT_EQ(swar::memchr8(padded("1234=").data(), '='), 4);
+    EXPECT_EQ(swar::memchr8(padded("123=4").data(), '='), 3);
+    EXPECT_EQ(swar::memchr8(padded("12=34").data(), '='), 2);
+    EXPECT_EQ(swar::memchr8(padded("1=234").data(), '='), 1);
+    EXPECT_EQ(swar::memchr8(padded("=1234").data(), '='), 0);
+
+    EXPECT_EQ(swar::memchr8(padded("===").data(), '='), 0);
+    EXPECT_EQ(swar::memchr8(padded("==").data(), '='), 0);
+    EXPECT_EQ(swar::memchr8(padded("=").data(), '='), 0);
+
+    // Aligned, with room for the vector loads
+    //                         123456789 123456789 123456789
+    alignas(64) char s1[64] = "1234567890abcdefghij=";
+    alignas(64) char s2[64] = "12345678=90abcdefghi";
+    alignas(64) char s3[64] = "1234=567890abcdefghi";
+    EXPECT_EQ(swar::memchr(s1, 20, '='), -1);
+    EXPECT_EQ(swar::memchr(s2, 20, '='), 8);
+    EXPECT_EQ(swar::memchr(s3, 20, '='), 4);
 
     char nc[24] = "1234567890abcdefghij=12";
     EXPECT_EQ(swar::memchr_nc(nc, 20, '='), -1);
@@ -37,6 +59,389 @@ TEST(r8, memchr) {
 
 }
 
+// Reference memchr/memrchr
+static uint32_t naive_memchr(const char* s, uint32_t len, uint8_t c) {
+    for (uint32_t i = 0; i < len; i++)
+        if ((uint8_t)s[i] == c)
+            return i;
+    return -1;
+}
+
+static uint32_t naive_memrchr(const char* s, uint32_t len, uint8_t c) {
+    for (uint32_t i = len; i-- > 0; )
+        if ((uint8_t)s[i] == c)
+            return i;
+    return -1;
+}
+
+typedef uint32_t (*memchr_fn)(const char*, uint32_t, uint8_t);
+
+// Compare against the naive impl for all alignments, lengths and positions
+static void check_memchr(memchr_fn f, bool reverse, bool known, bool printable) {
+    alignas(64) char buf[256];
+    for (uint32_t off = 0; off < 32; off++) {
+        for (uint32_t len = known; len < 100; len++) {
+            for (uint32_t pos = 0; pos <= len + 8; pos++) {
+                // Needle also around the range, to catch over-matching
+                memset(buf, printable ? 'a' : 0xaa, sizeof(buf));
+                buf[off + len + 8] = '=';
+                if (off)
+                    buf[off - 1] = '=';
+                if (pos < len || !known)
+                    buf[off + pos] = '=';
+                if (known && pos >= len)
+                    continue;
+                const char* s = buf + off;
+                uint32_t exp = reverse ? naive_memrchr(s, len, '=') :
+                                         naive_memchr(s, len, '=');
+                ASSERT_EQ(f(s, len, '='), exp) << off << " " << len << " " << pos;
+            }
+        }
+    }
+}
+
+// Strings that end a page, with no access to the next one, and start a
+// page, with no access to the one before
+TEST(r8, page_boundary) {
+    long page = sysconf(_SC_PAGESIZE);
+    char* m = (char*)mmap(nullptr, page * 3, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(m, MAP_FAILED);
+    ASSERT_EQ(mprotect(m, page, PROT_NONE), 0);
+    ASSERT_EQ(mprotect(m + page * 2, page, PROT_NONE), 0);
+    char* lo = m + page;
+    char* hi = m + page * 2;
+
+    // Bytes >= 128 around the string, for the printable variants
+    memset(lo, 0xff, page);
+    for (uint32_t len = 0; len < 80; len++) {
+        for (uint32_t pos = 0; pos <= len; pos++) {
+            // At the end of the page
+            char* s = hi - len;
+            memset(s, 'a', len);
+            if (pos < len)
+                s[pos] = '=';
+            uint32_t e = pos < len ? pos : -1;
+            ASSERT_EQ(swar::memchr<true>(s, len, '='), e) << len << " " << pos;
+            ASSERT_EQ(swar::pmemchr<true>(s, len, '='), e) << len << " " << pos;
+            ASSERT_EQ(swar::memrchr<true>(s, len, '='), e) << len << " " << pos;
+            ASSERT_EQ(swar::pmemrchr<true>(s, len, '='), e) << len << " " << pos;
+            ASSERT_EQ((swar::_memchr<false, false, true>(s, len, '=')), e);
+            ASSERT_EQ((swar::_memrchr<true, false, true>(s, len, '=')), e);
+            if (pos < len) {
+                ASSERT_EQ(swar::memchrk<true>(s, len, '='), e);
+                ASSERT_EQ(swar::pmemrchrk<true>(s, len, '='), e);
+                ASSERT_EQ((swar::_memrchr<false, true, true>(s, len, '=')), e);
+                s[len - 1] = '\0';
+                ASSERT_EQ(swar::strlen<true>(s), len - 1);
+                ASSERT_EQ(swar::pstrlen<true>(s), len - 1);
+            }
+            memset(s, 0xff, len);
+
+            // At the start of the page
+            s = lo;
+            memset(s, 'a', len);
+            if (pos < len)
+                s[pos] = '=';
+            ASSERT_EQ(swar::memrchr<true>(s, len, '='), e) << len << " " << pos;
+            ASSERT_EQ(swar::pmemrchr<true>(s, len, '='), e) << len << " " << pos;
+            ASSERT_EQ((swar::_memrchr<false, false, true>(s, len, '=')), e);
+            memset(s, 0xff, len);
+        }
+    }
+
+    // Unaligned strings, with bytes >= 128 before them
+    for (uint32_t off = 0; off < 16; off++) {
+        char* s = lo + off;
+        memset(s, 'a', 40);
+        s[33 - off] = '\0';
+        ASSERT_EQ(swar::strlen<true>(s), 33 - off);
+        ASSERT_EQ(swar::pstrlen<true>(s), 33 - off);
+        ASSERT_EQ(swar::strlen(s), 33 - off);
+        ASSERT_EQ(swar::pstrlen(s), 33 - off);
+        memset(lo, 0xff, 64);
+    }
+
+    munmap(m, page * 3);
+}
+
+// Padding of 0xff and needles, that must not be found
+TEST(r8, padded) {
+    for (uint32_t len = 0; len < 100; len++) {
+        swar::padded_buffer b(len);
+        EXPECT_EQ(b.capacity(), len);
+        for (uint32_t i = 0; i < swar::padding; i++)
+            b.data()[len + i] = i % 2 ? '=' : 0xff;
+
+        for (uint32_t pos = 0; pos <= len; pos++) {
+            std::string s(len, 'a');
+            if (pos < len)
+                s[pos] = '=';
+            b.assign(s.data(), len);
+            uint32_t e = pos < len ? pos : -1;
+            ASSERT_EQ(swar::memchr(b, '='), e) << len << " " << pos;
+            ASSERT_EQ(swar::pmemchr(b, '='), e) << len << " " << pos;
+
+            b.data()[len + 1] = '\0';
+            if (pos < len)
+                b.data()[pos] = '\0';
+            ASSERT_EQ(swar::strlen(b), pos) << len << " " << pos;
+            ASSERT_EQ(swar::pstrlen(b), pos) << len << " " << pos;
+        }
+    }
+
+    // A view of part of a buffer
+    swar::padded_buffer b(32);
+    b.assign("1234567890123456789012345", 25);
+    EXPECT_EQ(b.size(), 25u);
+    EXPECT_EQ(swar::atou(swar::padded_view(b.data() + 5, 10)), 6789012345u);
+    b.assign("-12345678901234567", 18);
+    EXPECT_EQ(swar::atoi(b), -12345678901234567ll);
+    b.resize(6);
+    EXPECT_EQ(swar::atoi(b), -12345);
+}
+
+TEST(r8, memchr_long) {
+    check_memchr(swar::memchr,    false, false, false);
+    check_memchr(swar::memchrk,   false, true,  false);
+    check_memchr(swar::pmemchr,   false, false, true);
+    check_memchr(swar::pmemchrk,  false, true,  true);
+    check_memchr(swar::memrchr,   true,  false, false);
+    check_memchr(swar::memrchrk,  true,  true,  false);
+    check_memchr(swar::pmemrchr,  true,  false, true);
+    check_memchr(swar::pmemrchrk, true,  true,  true);
+
+    // SWAR fallback
+    check_memchr(swar::_memchr<false, false>,  false, false, false);
+    check_memchr(swar::_memchr<true, true>,    false, true,  true);
+    check_memchr(swar::_memrchr<false, false>, true,  false, false);
+    check_memchr(swar::_memrchr<true, true>,   true,  true,  true);
+
+    // Aligned reads only
+    check_memchr(swar::memchr<true>,                 false, false, false);
+    check_memchr(swar::pmemrchrk<true>,              true,  true,  true);
+    check_memchr(swar::_memchr<false, false, true>,  false, false, false);
+    check_memchr(swar::_memchr<false, true, true>,   false, true,  false);
+    check_memchr(swar::_memchr<true, false, true>,   false, false, true);
+    check_memchr(swar::_memchr<true, true, true>,    false, true,  true);
+    check_memchr(swar::_memrchr<false, false, true>, true,  false, false);
+    check_memchr(swar::_memrchr<false, true, true>,  true,  true,  false);
+    check_memchr(swar::_memrchr<true, false, true>,  true,  false, true);
+    check_memchr(swar::_memrchr<true, true, true>,   true,  true,  true);
+
+    // Vector paths the cpu has
+    check_memchr(swar::_memchr16<false>,  false, false, false);
+    check_memchr(swar::_memchr16<true>,   false, true,  false);
+    check_memchr(swar::_memrchr16<false>, true,  false, false);
+    check_memchr(swar::_memrchr16<true>,  true,  true,  false);
+    if (__builtin_cpu_supports("avx2")) {
+        check_memchr(swar::_memchr32<false>,  false, false, false);
+        check_memchr(swar::_memchr32<true>,   false, true,  false);
+        check_memchr(swar::_memrchr32<false>, true,  false, false);
+        check_memchr(swar::_memrchr32<true>,  true,  true,  false);
+    }
+}
+
+// Reference multi-needle search
+static uint32_t naive_memchrset(const char* s, uint32_t len, const char* set, bool reverse) {
+    uint32_t ret = -1;
+    for (uint32_t i = 0; i < len; i++) {
+        if (::memchr(set, s[i], ::strlen(set))) {
+            ret = i;
+            if (!reverse)
+                break;
+        }
+    }
+    return ret;
+}
+
+TEST(r8, memchr_multi) {
+    EXPECT_EQ((swar::_memchr8<true, false, false>("abc|de=f", '=', '|')), 3);
+    EXPECT_EQ((swar::_memchr8<true, false, true>("abc|de=f", '=', '|')), 6);
+    EXPECT_EQ((swar::_memchr8<false, false, false>("abcdefgh", '=', '|', 1)), -1);
+    EXPECT_EQ((swar::_memchr8<false, true, false>("ab\x01|de=f", '=', '|', 1)), 2);
+
+    std::mt19937 mt(1);
+    alignas(64) char buf[256];
+    const char alphabet[] = "ab=|\x01\xaa\xfe";
+    swar::byteset set3("=|\x01", 3);
+    swar::byteset setb("=\xfe", 2);
+
+    for (uint32_t off = 0; off < 32; off++) {
+        for (uint32_t len = 0; len < 100; len++) {
+            for (int r = 0; r < 4; r++) {
+                // Mostly non-matching bytes, some needles
+                for (uint32_t i = 0; i < sizeof(buf); i++)
+                    buf[i] = mt() % 8 ? 'a' : alphabet[mt() % 7];
+                const char* s = buf + off;
+
+                uint32_t e2 = naive_memchrset(s, len, "=|", false);
+                uint32_t e2r = naive_memchrset(s, len, "=|", true);
+                uint32_t e3 = naive_memchrset(s, len, "=|\x01", false);
+                uint32_t e3r = naive_memchrset(s, len, "=|\x01", true);
+                uint32_t eb = naive_memchrset(s, len, "=\xfe", false);
+                uint32_t ebr = naive_memchrset(s, len, "=\xfe", true);
+
+                ASSERT_EQ(swar::memchr2(s, len, '=', '|'), e2);
+                ASSERT_EQ(swar::memrchr2(s, len, '=', '|'), e2r);
+                ASSERT_EQ(swar::memchr3(s, len, '=', '|', 1), e3);
+                ASSERT_EQ(swar::memrchr3(s, len, '=', '|', 1), e3r);
+                ASSERT_EQ(swar::memchrset(s, len, set3), e3);
+                ASSERT_EQ(swar::memrchrset(s, len, set3), e3r);
+                ASSERT_EQ(swar::memchrset(s, len, setb), eb);
+                ASSERT_EQ(swar::memrchrset(s, len, setb), ebr);
+
+                // SWAR path
+                swar::_match3<false> m3 = {'=', '|', 1};
+                ASSERT_EQ(swar::_scan<false>(s, len, m3), e3);
+                ASSERT_EQ(swar::_rscan<false>(s, len, m3), e3r);
+                swar::_matchset<false> mb = {setb};
+                ASSERT_EQ(swar::_scan<false>(s, len, mb), eb);
+                ASSERT_EQ(swar::_rscan<false>(s, len, mb), ebr);
+
+                // SSE2 path
+                ASSERT_EQ(swar::_vscan16<false>(s, len, m3), e3);
+                ASSERT_EQ(swar::_vrscan16<false>(s, len, m3), e3r);
+
+                if (e3 != (uint32_t)-1) {
+                    ASSERT_EQ(swar::memchr3k(s, len, '=', '|', 1), e3);
+                    ASSERT_EQ(swar::memrchr3k(s, len, '=', '|', 1), e3r);
+                    ASSERT_EQ(swar::memchrsetk(s, len, set3), e3);
+                    ASSERT_EQ(swar::memrchrsetk(s, len, set3), e3r);
+                }
+            }
+
+            // Printable input
+            for (uint32_t i = 0; i < sizeof(buf); i++)
+                buf[i] = mt() % 8 ? 'a' : alphabet[mt() % 5];
+            const char* s = buf + off;
+            uint32_t e3 = naive_memchrset(s, len, "=|\x01", false);
+            uint32_t e3r = naive_memchrset(s, len, "=|\x01", true);
+            ASSERT_EQ(swar::pmemchr3(s, len, '=', '|', 1), e3);
+            ASSERT_EQ(swar::pmemrchr3(s, len, '=', '|', 1), e3r);
+            ASSERT_EQ(swar::pmemchrset(s, len, set3), e3);
+            ASSERT_EQ(swar::pmemrchrset(s, len, set3), e3r);
+            ASSERT_EQ(swar::pmemchr2(s, len, '=', '|'), naive_memchrset(s, len, "=|", false));
+            ASSERT_EQ(swar::pmemrchr2(s, len, '=', '|'), naive_memchrset(s, len, "=|", true));
+        }
+    }
+}
+
+// Reference substring search
+static uint32_t naive_memmem(const char* s, uint32_t len, const char* n, uint32_t nlen, bool reverse) {
+    uint32_t ret = -1;
+    for (uint32_t i = 0; i + nlen <= len; i++) {
+        if (::memcmp(s + i, n, nlen) == 0) {
+            ret = i;
+            if (!reverse)
+                break;
+        }
+    }
+    return ret;
+}
+
+TEST(r8, memmem) {
+    // Room for the words and blocks read past the end
+    alignas(64) const char fix[64] = "8=FIX.4.2\x01" "9=12\x01" "35=D\x01" "10=123\x01";
+    uint32_t flen = ::strlen(fix);
+    EXPECT_EQ(swar::memmem(fix, flen, "35=", 3), 15u);
+    EXPECT_EQ(swar::memrmem(fix, flen, "\x01" "10=", 4), 19u);
+    EXPECT_EQ(swar::pmemmem(fix, flen, "=", 1), 1u);
+    EXPECT_EQ(swar::pmemrmem(fix, flen, "=", 1), 22u);
+    EXPECT_EQ(swar::memmem(fix, flen, "36=", 3), -1);
+    EXPECT_EQ(swar::memmem(fix, flen, "", 0), 0u);
+    EXPECT_EQ(swar::memrmem(fix, flen, "", 0), flen);
+    EXPECT_EQ(swar::memmem(fix, 3, "35=D\x01", 5), -1);
+
+    // Needles of 2, 4, 9, 16 and 20 chars, with the first and last chars
+    // often in the string, so most candidates fail the verify
+    const char* needles[] = { "=\x01", "\x01" "10=", "=\x01=\x01==\x01\x01=",
+                              "\x01=\x01\x01=\x01==\x01=\x01\x01==\x01=",
+                              "=\x01\x01=\x01=\x01\x01=\x01==\x01=\x01\x01==\x01\x01" };
+    std::mt19937 mt(3);
+    alignas(64) char buf[256];
+    const char alphabet[] = "a=\x01" "1\xaa";
+
+    for (const char* n : needles) {
+        uint32_t nlen = ::strlen(n);
+        swar::_needle nd(n, nlen);
+        for (uint32_t off = 0; off < 32; off++) {
+            for (uint32_t len = 0; len < 150; len++) {
+                for (int r = 0; r < 4; r++) {
+                    // Binary, then printable input
+                    bool printable = r >= 2;
+                    for (uint32_t i = 0; i < sizeof(buf); i++)
+                        buf[i] = mt() % 4 ? alphabet[mt() % (printable ? 3 : 5)] : n[mt() % nlen];
+                    // And a needle, about half the time in the string
+                    uint32_t at = mt() % (len + 8);
+                    if (off + at + nlen <= sizeof(buf) && r % 2)
+                        memcpy(buf + off + at, n, nlen);
+
+                    const char* s = buf + off;
+                    uint32_t e = naive_memmem(s, len, n, nlen, false);
+                    uint32_t er = naive_memmem(s, len, n, nlen, true);
+                    if (printable) {
+                        ASSERT_EQ(swar::pmemmem(s, len, n, nlen), e) << nlen << " " << off << " " << len;
+                        ASSERT_EQ(swar::pmemrmem(s, len, n, nlen), er) << nlen << " " << off << " " << len;
+                        continue;
+                    }
+                    ASSERT_EQ(swar::memmem(s, len, n, nlen), e) << nlen << " " << off << " " << len;
+                    ASSERT_EQ(swar::memrmem(s, len, n, nlen), er) << nlen << " " << off << " " << len;
+                    if (nlen > len)
+                        continue;
+
+                    // SWAR and vector paths
+                    uint32_t m = len - nlen + 1;
+                    ASSERT_EQ(swar::_memmem_scan<false>(s, 0, m, nd), e);
+                    ASSERT_EQ(swar::_memmem_rscan<false>(s, m, nd), er);
+                    ASSERT_EQ(swar::_memmem_vscan16<false>(s, m, nd), e);
+                    ASSERT_EQ(swar::_memmem_vrscan16<false>(s, m, nd), er);
+                    if (__builtin_cpu_supports("avx2")) {
+                        ASSERT_EQ(swar::_memmem_vscan32<false>(s, m, nd), e);
+                        ASSERT_EQ(swar::_memmem_vrscan32<false>(s, m, nd), er);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(r8, bitindex) {
+    EXPECT_EQ(swar::_highbits(0x8000000000000080ull), 0x81u);
+    EXPECT_EQ(swar::_highbits(0x8080808080808080ull), 0xffu);
+    EXPECT_EQ(swar::_highbits(0x0000800000008000ull), 0x22u);
+
+    std::mt19937 mt(2);
+    const char alphabet[] = "a=\x01\xaa";
+    for (uint32_t len = 0; len < 300; len++) {
+        std::vector<char> v(len);
+        for (uint32_t i = 0; i < len; i++)
+            v[i] = alphabet[mt() % 4];
+
+        uint64_t e1[5], e2[5], b1[5], b2[5], p1[5], p2[5];
+        memset(e1, 0, sizeof(e1));
+        memset(e2, 0, sizeof(e2));
+        for (uint32_t i = 0; i < len; i++) {
+            e1[i / 64] |= uint64_t(v[i] == '=') << (i % 64);
+            e2[i / 64] |= uint64_t(v[i] == 1) << (i % 64);
+        }
+
+        // Exact size vector, so ASan can tell if we read past len
+        swar::bitindex(v.data(), len, '=', 1, b1, b2);
+        for (uint32_t i = 0; i < (len + 63) / 64; i++) {
+            ASSERT_EQ(b1[i], e1[i]) << len << " " << i;
+            ASSERT_EQ(b2[i], e2[i]) << len << " " << i;
+        }
+
+        // SWAR path
+        for (uint32_t i = 0; i + 64 <= len; i += 64) {
+            swar::_bitmap64<false>(v.data() + i, '=', 1, p1[0], p2[0]);
+            ASSERT_EQ(p1[0], e1[i / 64]);
+            ASSERT_EQ(p2[0], e2[i / 64]);
+        }
+    }
+}
+
 TEST(r8, cast8) {
     EXPECT_EQ(swar::cast8("1234567890", 0),                      0);
     EXPECT_EQ(swar::cast8("1234567890", 1),                0x31ull);
@@ -155,6 +560,615 @@ TEST(r8, atoi) {
     EXPECT_EQ(swar::atoi("-12345678901234567890", 20), -1234567890123456789ll);
 }
 
+TEST(r8, parse) {
+    // Every byte value, in every position
+    for (int c = 1; c < 256; c++) {
+        for (int pos = 0; pos < 8; pos++) {
+            char buf[9] = "00000000";
+            buf[pos] = c;
+            uint64_t x = swar::cast<uint64_t>(buf);
+            bool digit = c >= '0' && c <= '9';
+            bool hex = digit || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+            ASSERT_EQ(swar::_digits8(x), digit ? 8u : pos) << c;
+            ASSERT_EQ(swar::_hexdigits8(x), hex ? 8u : pos) << c;
+            ASSERT_EQ(swar::_bytesbetween(x, 'a', 'z') != 0, c >= 'a' && c <= 'z') << c;
+        }
+    }
+
+    // Random digit strings and terminators, against strtoull
+    std::mt19937_64 mt(5);
+    const char terms[] = "\x01 =.x-g\xff";
+    for (int n = 0; n < 100000; n++) {
+        char buf[64];
+        uint32_t ndig = mt() % 25;
+        uint32_t nhex = mt() % 21;
+        bool dec = n % 2;
+        uint32_t len = dec ? ndig : nhex;
+        for (uint32_t i = 0; i < len; i++)
+            buf[i] = dec ? '0' + mt() % 10 : "0123456789abcdefABCDEF"[mt() % 22];
+        buf[len] = terms[mt() % 8];
+        for (uint32_t i = len + 1; i < sizeof(buf); i++)
+            buf[i] = '0' + mt() % 10;
+
+        // end may cut the digits
+        uint32_t elen = mt() % 4 ? len + 1 : mt() % (len + 1);
+        uint32_t exp = len < elen ? len : elen;
+        std::string str(buf, exp);
+
+        uint64_t out = 777;
+        const char* p = dec ? swar::parse_uint(buf, buf + elen, out) :
+                              swar::parse_hex(buf, buf + elen, out);
+        ASSERT_EQ(p, buf + exp) << str;
+        ASSERT_EQ(out, exp ? strtoull(str.c_str(), nullptr, dec ? 10 : 16) : 777) << str;
+    }
+
+    int64_t i64 = 0;
+    std::string bs1 = padded("-1234567890123456789|");
+    const char* s1 = bs1.data();
+    EXPECT_EQ(swar::parse_int(s1, s1 + 21, i64), s1 + 20);
+    EXPECT_EQ(i64, -1234567890123456789ll);
+    std::string bs2 = padded("+42,");
+    const char* s2 = bs2.data();
+    EXPECT_EQ(swar::parse_int(s2, s2 + 4, i64), s2 + 3);
+    EXPECT_EQ(i64, 42);
+    std::string bs3 = padded("-x");
+    const char* s3 = bs3.data();
+    EXPECT_EQ(swar::parse_int(s3, s3 + 2, i64), s3);
+    EXPECT_EQ(i64, 42);
+    EXPECT_EQ(swar::parse_int(s3, s3, i64), s3);
+    std::string bs4 = padded("18446744073709551615");
+    const char* s4 = bs4.data();
+    uint64_t u64 = 0;
+    EXPECT_EQ(swar::parse_uint(s4, s4 + 20, u64), s4 + 20);
+    EXPECT_EQ(u64, 18446744073709551615ull);
+
+    // Out of range saturates
+    std::string bs5 = padded("86973198959106710414");
+    const char* s5 = bs5.data();
+    EXPECT_EQ(swar::parse_uint(s5, s5 + 20, u64), s5 + 20);
+    EXPECT_EQ(u64, ~0ull);
+    EXPECT_EQ(swar::parse_int(s5, s5 + 20, i64), s5 + 20);
+    EXPECT_EQ(i64, INT64_MAX);
+    std::string bs6 = padded("-9223372036854775808 -9223372036854775809 9223372036854775808");
+    const char* s6 = bs6.data();
+    EXPECT_EQ(swar::parse_int(s6, s6 + 20, i64), s6 + 20);
+    EXPECT_EQ(i64, INT64_MIN);
+    EXPECT_EQ(swar::parse_int(s6 + 21, s6 + 41, i64), s6 + 41);
+    EXPECT_EQ(i64, INT64_MIN);
+    EXPECT_EQ(swar::parse_int(s6 + 42, s6 + 61, i64), s6 + 61);
+    EXPECT_EQ(i64, INT64_MAX);
+
+    // A multiple of 8 digits that ends at end does not load a word at end
+    for (uint32_t len = 8; len <= 16; len += 8) {
+        std::vector<char> v(len + 7, '1');
+        EXPECT_EQ(swar::parse_uint(v.data(), v.data() + len, u64), v.data() + len);
+        EXPECT_EQ(swar::parse_hex(v.data(), v.data() + len, u64), v.data() + len);
+    }
+}
+
+TEST(r8, checked) {
+    using swar::parse_ok;
+    using swar::parse_invalid;
+    using swar::parse_overflow;
+
+    // Random strings, with a bad char sometimes, against strtoull
+    std::mt19937_64 mt(7);
+    for (int n = 0; n < 200000; n++) {
+        char buf[32];
+        for (uint32_t i = 0; i < sizeof(buf); i++)
+            buf[i] = '0' + mt() % 10;
+        uint32_t len = mt() % 22;
+        bool hex = n % 2;
+        if (hex) {
+            len = mt() % 18;
+            for (uint32_t i = 0; i < len; i++)
+                buf[i] = "0123456789abcdefABCDEF"[mt() % 22];
+        }
+        // bytes past len never matter
+        buf[len] = "x/:\xff"[mt() % 4];
+        bool bad = len && mt() % 3 == 0;
+        if (bad)
+            buf[mt() % len] = "/:`@gG \x01\x80\xff"[mt() % 10];
+        std::string str(buf, len);
+
+        uint64_t out = 777;
+        swar::parse_error err = hex ? swar::htou_checked(buf, len, out) :
+                                      swar::atou_checked(buf, len, out);
+        if (!len || bad) {
+            ASSERT_EQ(err, len > (hex ? 16u : 20u) ? parse_overflow : parse_invalid) << str;
+            ASSERT_EQ(out, 777u) << str;
+            continue;
+        }
+        errno = 0;
+        uint64_t exp = strtoull(str.c_str(), nullptr, hex ? 16 : 10);
+        bool of = errno == ERANGE || len > (hex ? 16u : 20u);
+        ASSERT_EQ(err, of ? parse_overflow : parse_ok) << str;
+        ASSERT_EQ(out, of ? 777 : exp) << str;
+
+        if (len <= 8 && !hex) {
+            uint32_t out32 = 777;
+            ASSERT_EQ(swar::atou8_checked(buf, len, out32), parse_ok) << str;
+            ASSERT_EQ(out32, exp) << str;
+        }
+    }
+
+    // Edges of 20 digits
+    uint64_t u64 = 0;
+    EXPECT_EQ(swar::atou_checked(padded("18446744073709551615").data(), 20, u64), parse_ok);
+    EXPECT_EQ(u64, 18446744073709551615ull);
+    EXPECT_EQ(swar::atou_checked(padded("18446744073709551616").data(), 20, u64), parse_overflow);
+    EXPECT_EQ(swar::atou_checked(padded("18450000000000000000").data(), 20, u64), parse_overflow);
+    EXPECT_EQ(swar::atou_checked(padded("99999999999999999999").data(), 20, u64), parse_overflow);
+    EXPECT_EQ(swar::atou_checked(padded("09999999999999999999").data(), 20, u64), parse_ok);
+    EXPECT_EQ(u64, 9999999999999999999ull);
+    uint32_t u32 = 0;
+    EXPECT_EQ(swar::atou8_checked(padded("").data(), 0, u32), parse_invalid);
+    EXPECT_EQ(swar::atou8_checked(padded("1234567x").data(), 8, u32), parse_invalid);
+    EXPECT_EQ(swar::atou8_checked(padded("12345678").data(), 8, u32), parse_ok);
+    EXPECT_EQ(u32, 12345678u);
+
+    int64_t i64 = 0;
+    EXPECT_EQ(swar::atoi_checked(padded("-9223372036854775808").data(), 20, i64), parse_ok);
+    EXPECT_EQ(i64, INT64_MIN);
+    EXPECT_EQ(swar::atoi_checked(padded("+9223372036854775807").data(), 20, i64), parse_ok);
+    EXPECT_EQ(i64, INT64_MAX);
+    EXPECT_EQ(swar::atoi_checked(padded("9223372036854775808").data(), 19, i64), parse_overflow);
+    EXPECT_EQ(swar::atoi_checked(padded("-9223372036854775809").data(), 20, i64), parse_overflow);
+    EXPECT_EQ(swar::atoi_checked(padded("-").data(), 1, i64), parse_invalid);
+    EXPECT_EQ(swar::atoi_checked(padded("--1").data(), 3, i64), parse_invalid);
+    EXPECT_EQ(swar::atoi_checked(padded("").data(), 0, i64), parse_invalid);
+    EXPECT_EQ(swar::atoi_checked(padded("-42").data(), 3, i64), parse_ok);
+    EXPECT_EQ(i64, -42);
+
+    // Up to 20 digits after the sign, even if the leading ones are zeros
+    EXPECT_EQ(swar::atoi_checked(padded("-00266059844488202166").data(), 21, i64), parse_ok);
+    EXPECT_EQ(i64, -266059844488202166ll);
+    EXPECT_EQ(swar::atoi_checked(padded("002660598444882021667").data(), 21, i64), parse_overflow);
+    EXPECT_EQ(swar::atoi_checked(padded("+002660598444882021667").data(), 22, i64), parse_overflow);
+}
+
+TEST(r8, atou_batch) {
+    std::mt19937_64 mt(4);
+    for (uint32_t len = 0; len <= 20; len++) {
+        for (size_t stride = len + (len == 0); stride < len + 3; stride++) {
+            for (size_t n = 0; n < 21; n++) {
+                // Fields of random digits, followed by random junk. On the
+                // heap, with 7 bytes after the last field, and at least a
+                // word, so ASan catches a longer read
+                std::vector<char> buf(n ? (n - 1) * stride + std::max(len + 7, 8u) : 0);
+                for (size_t i = 0; i < buf.size(); i++)
+                    buf[i] = '0' + mt() % 10;
+                for (size_t i = 0; i + 1 < n; i++)
+                    for (size_t j = len; j < stride; j++)
+                        buf[i * stride + j] = mt() % 2 ? '|' : 'x';
+
+                std::vector<uint64_t> out(n), ref(n);
+                for (size_t i = 0; i < n; i++)
+                    ref[i] = swar::atou(buf.data() + i * stride, len);
+
+                swar::atou_batch(buf.data(), stride, len, out.data(), n);
+                ASSERT_EQ(out, ref) << len << " " << stride << " " << n;
+
+                swar::_atou_batch16(buf.data(), stride, len, out.data(), n);
+                ASSERT_EQ(out, ref) << len << " " << stride << " " << n;
+                if (__builtin_cpu_supports("avx2")) {
+                    swar::_atou_batch32(buf.data(), stride, len, out.data(), n);
+                    ASSERT_EQ(out, ref) << len << " " << stride << " " << n;
+                }
+
+                if (len > 8)
+                    continue;
+
+                std::vector<uint32_t> out8(n), ref8(n);
+                for (size_t i = 0; i < n; i++)
+                    ref8[i] = swar::atou8(buf.data() + i * stride, len);
+
+                swar::atou8_batch(buf.data(), stride, len, out8.data(), n);
+                ASSERT_EQ(out8, ref8) << len << " " << stride << " " << n;
+
+                swar::_atou8_batch16(buf.data(), stride, len, out8.data(), n);
+                ASSERT_EQ(out8, ref8) << len << " " << stride << " " << n;
+            }
+        }
+    }
+}
+
+static void check_atod(const std::string& str) {
+    double exp = strtod(str.c_str(), nullptr);
+    double d = swar::atod(padded(str.c_str()).data(), str.size());
+    if (exp != exp) {
+        ASSERT_TRUE(d != d) << str;
+        return;
+    }
+    uint64_t b1, b2;
+    memcpy(&b1, &exp, 8);
+    memcpy(&b2, &d, 8);
+    ASSERT_EQ(b2, b1) << str << " " << exp << " " << d;
+}
+
+TEST(r8, atod) {
+    const char* cases[] = {
+        "0", "-0", "+0", "0.0", "-0.0", "1.5", "-0.5", ".5", "5.", "-.25",
+        "123.4567", "99999.99", "0.000001", "1e10", "1E-10", "1e", "1e+",
+        "2e-", "1.e5", "-1.5e+3x", "12,5", "x", "", ".", "-", "+.e1",
+        "inf", "-Infinity", "INF", "nan", "-NaN", "in", "na",
+        "9007199254740992", "9007199254740993", "9007199254740995",
+        "18446744073709551615", "18446744073709551616",
+        "123456789012345678901234567890", "0.1234567890123456789012345",
+        "0.00000000000000000000000000000000001234",
+        "000000000000000000000000000000000000001",
+        "1e22", "1e23", "1e-22", "1e-23", "1e308", "1.8e308", "1e309",
+        "1e-320", "1e-400", "0e999999999999", "1e-999999999999",
+        "1e0000000005", "1e00000000000000001", "1.5e-0000000000003",
+        "1e+0000000000000000000000308", "1e-00000000000000000000000000",
+        "2.2250738585072011e-308", "2.2250738585072014e-308",
+        "4.9406564584124654e-324", "2.4703282292062327e-324",
+        "2.4703282292062328e-324", "1.7976931348623157e308",
+        "1.7976931348623158e308", "1.7976931348623159e308",
+        "7.2057594037927933e16", "8.988465674311579539e307",
+        "9007199254740993.0000000000000000000000000000001",
+        "4503599627370496.5", "4503599627370497.5",
+        "179769313486231580793728971405303415079934132710037826936173778980444"
+        "968292764750946649017977587207096330286416692887910946555547851940402"
+        "630657488671505820681908902000708383676273854845817711531764475730270"
+        "069855571366959622842914819860834936475292719074168444365510704342711"
+        "559699508093042880177904174497791.9999999999",
+    };
+    for (const char* c : cases)
+        check_atod(c);
+
+    // A multiple of 8 digits that ends at end does not load a word at end
+    for (const char* c : {"1234567812345678", "1234567.12345678", "1e12345678"}) {
+        size_t len = strlen(c);
+        std::vector<char> v(len + 7);
+        memcpy(v.data(), c, len);
+        EXPECT_EQ(swar::atod(v.data(), len), strtod(c, nullptr)) << c;
+    }
+
+    std::mt19937_64 mt(8);
+    char buf[2048];
+    for (int n = 0; n < 300000; n++) {
+        std::string str;
+        switch (n % 4) {
+        case 0: {
+            // random digits, dot and exponent
+            if (mt() % 4 == 0)
+                str += "-+"[mt() % 2];
+            uint32_t il = mt() % 24;
+            uint32_t fl = mt() % 24;
+            for (uint32_t i = 0; i < il; i++)
+                str += mt() % 3 ? '0' + mt() % 10 : '0';
+            if (fl || mt() % 2)
+                str += '.';
+            for (uint32_t i = 0; i < fl; i++)
+                str += '0' + mt() % 10;
+            if (mt() % 2) {
+                // with leading zeros, that do not count
+                int e = (int)(mt() % 700) - 350;
+                sprintf(buf, "e%s%0*d", e < 0 ? "-" : "", (int)(mt() % 16), abs(e));
+                str += buf;
+            }
+            break;
+        }
+        case 1: {
+            // any double, shortest and not
+            uint64_t bits = mt();
+            double d;
+            memcpy(&d, &bits, 8);
+            sprintf(buf, "%.*g", (int)(mt() % 18) + 1, d);
+            str = buf;
+            break;
+        }
+        case 2: {
+            // prices
+            sprintf(buf, "%.*f", (int)(mt() % 9), (mt() % 100000000) / 100.0);
+            str = buf;
+            break;
+        }
+        case 3: {
+            // half way between two doubles, exact. Long mantissa
+            uint64_t bits = mt() % 0x7fe0000000000000ull;
+            double d1, d2;
+            memcpy(&d1, &bits, 8);
+            bits++;
+            memcpy(&d2, &bits, 8);
+            sprintf(buf, "%.*Le", (int)(mt() % 40) + 760,
+                    ((long double)d1 + d2) / 2);
+            str = buf;
+            break;
+        }
+        }
+        check_atod(str);
+    }
+}
+
+// Ticks of 10^-scale, from the chars, with wide ints
+static __int128 naive_atofixed(const std::string& s, int scale, bool& inexact) {
+    size_t i = s[0] == '-' || s[0] == '+';
+    __int128 x = 0;
+    int dec = -1;
+    int round = 0;
+    inexact = false;
+    for (; i < s.size(); i++) {
+        if (s[i] == '.') {
+            dec = 0;
+            continue;
+        }
+        if (dec >= scale) {
+            round |= dec == scale && s[i] >= '5';
+            inexact |= s[i] != '0';
+            dec++;
+            continue;
+        }
+        x = x * 10 + s[i] - '0';
+        dec += dec >= 0;
+    }
+    for (int d = dec < 0 ? 0 : dec; d < scale; d++)
+        x *= 10;
+    x += round;
+    return s[0] == '-' ? -x : x;
+}
+
+template <int Scale>
+static void check_atofixed(std::mt19937_64& mt) {
+    for (int n = 0; n < 20000; n++) {
+        std::string str;
+        if (mt() % 3 == 0)
+            str += "-+"[mt() % 2];
+        uint32_t il = mt() % 12;
+        uint32_t fl = mt() % 22;
+        for (uint32_t i = 0; i < il; i++)
+            str += '0' + mt() % 10;
+        bool dot = fl || mt() % 2;
+        if (dot)
+            str += '.';
+        for (uint32_t i = 0; i < fl; i++)
+            str += mt() % 4 ? '0' : '0' + mt() % 10;
+        if (!il && !fl)
+            continue;
+
+        bool inexact;
+        __int128 exp = naive_atofixed(str, Scale, inexact);
+        std::string b = padded(str.c_str());
+        ASSERT_EQ(swar::atofixed<Scale>(b.data(), str.size()), (int64_t)exp) << str;
+
+        int64_t out = 777;
+        swar::parse_error err = swar::atofixed_checked<Scale>(b.data(), str.size(), out);
+        bool of = exp > INT64_MAX || exp < INT64_MIN;
+        if (inexact)
+            ASSERT_EQ(err, swar::parse_inexact) << str;
+        else if (of)
+            ASSERT_EQ(err, swar::parse_overflow) << str;
+        else {
+            ASSERT_EQ(err, swar::parse_ok) << str;
+            ASSERT_EQ(out, (int64_t)exp) << str;
+        }
+    }
+}
+
+TEST(r8, atofixed) {
+    std::mt19937_64 mt(10);
+    check_atofixed<0>(mt);
+    check_atofixed<2>(mt);
+    check_atofixed<4>(mt);
+    check_atofixed<8>(mt);
+    check_atofixed<18>(mt);
+
+    auto fx = [](const char* s) {
+        std::string b = padded(s);
+        return swar::atofixed<4>(b.data(), strlen(s));
+    };
+    EXPECT_EQ(fx("123.4567"), 1234567);
+    EXPECT_EQ(fx("-123.45"), -1234500);
+    EXPECT_EQ(fx("123"), 1230000);
+    EXPECT_EQ(fx(".5"), 5000);
+    EXPECT_EQ(fx("0.00005"), 1);
+    EXPECT_EQ(fx("0.00004999"), 0);
+    EXPECT_EQ(fx("-0.00005"), -1);
+
+    auto fc = [](const char* s, int64_t& out) {
+        std::string b = padded(s);
+        return swar::atofixed_checked<2>(b.data(), strlen(s), out);
+    };
+    int64_t out = 0;
+    EXPECT_EQ(fc("1.2300", out), swar::parse_ok);
+    EXPECT_EQ(out, 123);
+    EXPECT_EQ(fc("1.231", out), swar::parse_inexact);
+    EXPECT_EQ(fc("1.2x", out), swar::parse_invalid);
+    EXPECT_EQ(fc("1.230x", out), swar::parse_invalid);
+    EXPECT_EQ(fc("1x.2", out), swar::parse_invalid);
+    EXPECT_EQ(fc(".", out), swar::parse_invalid);
+    EXPECT_EQ(fc("-", out), swar::parse_invalid);
+    EXPECT_EQ(fc("", out), swar::parse_invalid);
+    EXPECT_EQ(fc("5.", out), swar::parse_ok);
+    EXPECT_EQ(out, 500);
+    EXPECT_EQ(fc("-92233720368547758.08", out), swar::parse_ok);
+    EXPECT_EQ(out, INT64_MIN);
+    EXPECT_EQ(fc("92233720368547758.08", out), swar::parse_overflow);
+    EXPECT_EQ(out, INT64_MIN);
+}
+
+template <int Scale>
+static void check_fixedtoa(int64_t ticks) {
+    uint64_t scale = 1;
+    for (int i = 0; i < Scale; i++)
+        scale *= 10;
+    uint64_t x = ticks < 0 ? 0 - (uint64_t)ticks : ticks;
+    char ref[64];
+    sprintf(ref, "%s%llu.%0*llu", ticks < 0 ? "-" : "",
+            (unsigned long long)(x / scale), Scale, (unsigned long long)(x % scale));
+
+    char buf[32];
+    ASSERT_EQ(swar::fixedtoa<Scale>(ticks, buf), strlen(ref));
+    ASSERT_STREQ(buf, ref);
+
+    std::string trim = ref;
+    while (trim.back() == '0')
+        trim.pop_back();
+    if (trim.back() == '.')
+        trim.pop_back();
+    ASSERT_EQ((swar::fixedtoa<Scale, true>(ticks, buf)), trim.size());
+    ASSERT_STREQ(buf, trim.c_str());
+
+    // Parses back
+    if (Scale <= 8) {
+        std::string b = padded(ref);
+        ASSERT_EQ(swar::atofixed<Scale>(b.data(), strlen(ref)), ticks) << ref;
+    }
+}
+
+TEST(r8, fixedtoa) {
+    char buf[32];
+    EXPECT_EQ(swar::fixedtoa<4>(1234500, buf), 8u);
+    EXPECT_STREQ(buf, "123.4500");
+    EXPECT_EQ((swar::fixedtoa<4, true>(1234500, buf)), 6u);
+    EXPECT_STREQ(buf, "123.45");
+    EXPECT_EQ((swar::fixedtoa<4, true>(-1230000, buf)), 4u);
+    EXPECT_STREQ(buf, "-123");
+    EXPECT_EQ(swar::fixedtoa<2>(-5, buf), 5u);
+    EXPECT_STREQ(buf, "-0.05");
+
+    std::mt19937_64 mt(11);
+    for (int64_t t : { (int64_t)0, (int64_t)1, (int64_t)-1, INT64_MAX, INT64_MIN }) {
+        check_fixedtoa<1>(t);
+        check_fixedtoa<8>(t);
+    }
+    for (int n = 0; n < 100000; n++) {
+        int64_t t = (int64_t)mt() >> (mt() % 64);
+        check_fixedtoa<1>(t);
+        check_fixedtoa<2>(t);
+        check_fixedtoa<4>(t);
+        check_fixedtoa<7>(t);
+        check_fixedtoa<8>(t);
+    }
+}
+
+// Significant digits and decimal exponent of a number string, like
+// "12.5" --> "125", 0 and "1.2e-3" --> "12", -4
+static void decimal_of(const char* s, std::string& digits, int& exp) {
+    digits.clear();
+    exp = 0;
+    int dot = -1;
+    const char* p = s + (*s == '-');
+    for (; *p && *p != 'e'; p++) {
+        if (*p == '.')
+            dot = digits.size();
+        else
+            digits += *p;
+    }
+    exp = (dot < 0 ? 0 : dot - (int)digits.size()) + (*p ? atoi(p + 1) : 0);
+    while (digits.size() > 1 && digits[0] == '0')
+        digits.erase(0, 1);
+    while (digits.size() > 1 && digits.back() == '0') {
+        digits.pop_back();
+        exp++;
+    }
+}
+
+static void check_dtoa(double x) {
+    char buf[32];
+    uint32_t len = swar::dtoa(x, buf);
+    ASSERT_EQ(len, strlen(buf));
+
+    // Parses back
+    double y = strtod(buf, nullptr);
+    ASSERT_EQ(memcmp(&x, &y, 8), 0) << buf;
+
+    // Shortest, and the closest of the shortest. After a power of 2 the
+    // interval is not symmetric, and a shorter, not closest, may parse back
+    char ref[64];
+    for (int prec = 0; prec < 17; prec++) {
+        sprintf(ref, "%.*e", prec, x);
+        if (strtod(ref, nullptr) == x)
+            break;
+    }
+    std::string d1, d2;
+    int e1, e2;
+    decimal_of(buf, d1, e1);
+    decimal_of(ref, d2, e2);
+    ASSERT_LE(d1.size(), d2.size()) << buf << " " << ref;
+    if (d1.size() == d2.size()) {
+        ASSERT_EQ(d1, d2) << buf << " " << ref;
+        ASSERT_EQ(e1, e2) << buf << " " << ref;
+    }
+}
+
+template <int N>
+static void check_dtoa_fixed(double x) {
+    char buf[swar::dtoa_fixed_max];
+    char ref[512];
+    uint32_t len = swar::dtoa<N>(x, buf);
+    ASSERT_EQ(len, strlen(buf));
+    snprintf(ref, sizeof(ref), "%.*f", N, x);
+    ASSERT_STREQ(buf, ref) << N;
+}
+
+TEST(r8, dtoa) {
+    struct { double x; const char* s; } cases[] = {
+        { 0.0, "0" }, { -0.0, "-0" }, { 1.0, "1" }, { -1.5, "-1.5" },
+        { 123.45, "123.45" }, { 0.1, "0.1" }, { 0.000012, "0.000012" },
+        { 1e-7, "1e-7" }, { 1.5e21, "1.5e+21" }, { 1e21, "1e+21" },
+        { 1e20, "100000000000000000000" }, { 12300, "12300" },
+        { 1.0 / 3, "0.3333333333333333" }, { 9007199254740992.0, "9007199254740992" },
+        { 5e-324, "5e-324" }, { 1.7976931348623157e308, "1.7976931348623157e+308" },
+        { 2.2250738585072014e-308, "2.2250738585072014e-308" },
+        { std::numeric_limits<double>::infinity(), "inf" },
+        { -std::numeric_limits<double>::infinity(), "-inf" },
+        { std::numeric_limits<double>::quiet_NaN(), "nan" },
+    };
+    for (auto& c : cases) {
+        char buf[32];
+        EXPECT_EQ(swar::dtoa(c.x, buf), strlen(c.s));
+        EXPECT_STREQ(buf, c.s);
+    }
+
+    // Powers of 2 have a closer lower neighbour
+    for (int e = -1074; e < 1024; e++)
+        check_dtoa(ldexp(1.0, e));
+
+    std::mt19937_64 mt(9);
+    for (int n = 0; n < 100000; n++) {
+        uint64_t bits = mt();
+        double x;
+        memcpy(&x, &bits, 8);
+        if (n % 3 == 1)
+            x = (int64_t)(mt() % 100000000) / 100.0;
+        if (n % 3 == 2)
+            x = (double)(int64_t)(bits >> (mt() % 64));
+        if (x == x && x - x == 0)
+            check_dtoa(x);
+    }
+
+    // Fixed. Half way cases round to even, like printf
+    // Past 2^64 and 2^128 too, like a notional of 340378918610 at N = 8
+    for (double x : { 0.5, 1.5, 2.5, 0.125, 0.375, -0.001, 1.005, 1e-300,
+                      1e15, 1.8e19, 1e300, -1e300, 340378918610.0, -1.84467e11,
+                      1.8446744073709552e19, 3.4e38, 3.5e38, -1e21, 4.5e20,
+                      -1.7976931348623157e308 }) {
+        check_dtoa_fixed<0>(x);
+        check_dtoa_fixed<2>(x);
+        check_dtoa_fixed<8>(x);
+        check_dtoa_fixed<17>(x);
+    }
+    for (int n = 0; n < 30000; n++) {
+        uint64_t bits = mt();
+        double x;
+        memcpy(&x, &bits, 8);
+        if (n % 2)
+            x = (int64_t)(mt() % 10000000000ull) / 1e6;
+        if (n % 4 == 2)
+            x = ldexp((double)(mt() >> 11), mt() % 96);
+        if (x != x || x - x != 0)
+            continue;
+        check_dtoa_fixed<0>(x);
+        check_dtoa_fixed<1>(x);
+        check_dtoa_fixed<2>(x);
+        check_dtoa_fixed<6>(x);
+        check_dtoa_fixed<8>(x);
+        check_dtoa_fixed<17>(x);
+    }
+}
+
 TEST(r8, htou) {
     EXPECT_EQ(swar::htou8("123456789abcdef0", 0), 0);
     EXPECT_EQ(swar::htou8("123456789abcdef0", 1), 0x1);
@@ -209,6 +1223,67 @@ TEST(r8, htou) {
     EXPECT_EQ(swar::htou8("1234abef", 8),  0x1234abef);
 }
 
+// Naive unsigned __int128 to string, a digit at a time
+std::string naive_utoa128(unsigned __int128 x) {
+    std::string s;
+    do {
+        s.insert(s.begin(), '0' + (int)(x % 10));
+        x /= 10;
+    } while (x);
+    return s;
+}
+
+TEST(r8, int128) {
+    unsigned __int128 max = ~(unsigned __int128)0;
+    unsigned __int128 e16 = 10000000000000000ull;
+    std::vector<unsigned __int128> edges = { 0, 1, 9, 10, ~0ull, (unsigned __int128)~0ull + 1,
+        e16 - 1, e16, e16 * e16 - 1, e16 * e16, e16 * e16 * 1000000 - 1, max, max - 1 };
+    std::mt19937_64 mt(24);
+    for (int i = 0; i < 200000; i++) {
+        unsigned __int128 x = ((unsigned __int128)mt() << 64) | mt();
+        edges.push_back(x >> (mt() % 128));
+    }
+    // Powers of 10, and their neighbours
+    for (unsigned __int128 p = 1; p <= max / 10; p *= 10) {
+        edges.push_back(p - 1);
+        edges.push_back(p);
+        edges.push_back(p * 10 - 1);
+    }
+
+    for (unsigned __int128 x : edges) {
+        std::string expected = naive_utoa128(x);
+        char buf[48];
+        ASSERT_EQ(swar::utoa128(x, buf), expected.size());
+        ASSERT_EQ(std::string(buf), expected);
+        ASSERT_TRUE(swar::_div1e16(x) == x / e16) << expected;
+
+        std::string padded_x = padded(expected.c_str());
+        ASSERT_TRUE(swar::atou128(padded_x.data(), expected.size()) == x) << expected;
+
+        // Signed, if it fits
+        if (x <= max / 2) {
+            __int128 v = x;
+            ASSERT_EQ(swar::itoa128(v, buf), expected.size());
+            ASSERT_EQ(std::string(buf), expected);
+            ASSERT_EQ(swar::itoa128(-v, buf), expected.size() + (x != 0));
+            ASSERT_EQ(std::string(buf), (x ? "-" : "") + expected);
+            std::string neg = padded(buf);
+            ASSERT_TRUE(swar::atoi128(neg.data(), ::strlen(buf)) == -v) << buf;
+        }
+    }
+
+    // The minimum, and leading zeros
+    char buf[48];
+    __int128 min = -(__int128)(max / 2) - 1;
+    ASSERT_EQ(swar::itoa128(min, buf), 40u);
+    EXPECT_STREQ(buf, "-170141183460469231731687303715884105728");
+    EXPECT_TRUE(swar::atoi128(padded(buf).data(), 40) == min);
+    EXPECT_TRUE(swar::atou128(padded("000000000000000000000000000000000000042").data(), 39) == 42);
+    EXPECT_TRUE(swar::atoi128(padded("+12345678901234567890123").data(), 24) ==
+                (__int128)(1234567 * e16 + 8901234567890123ull));
+    EXPECT_TRUE(swar::atou128(padded("").data(), 0) == 0);
+}
+
 TEST(r8, itoa) {
     union {
         char test_buf[100];
@@ -223,12 +1298,40 @@ TEST(r8, itoa) {
     }
 
     for (int64_t i = std::numeric_limits<int64_t>::min();
-        i < std::numeric_limits<int64_t>::min(); i += 13371) {
+        i < std::numeric_limits<int64_t>::max() - 13371133711337113ll;
+        i += 13371133711337113ll) {
         sprintf(test_buf, "%ld", i);
         swar::itoa(i, itoa_ret);
         EXPECT_STREQ(itoa_ret, test_buf);
     }
 
+    // Every length, and both sides of each power of 10
+    std::mt19937_64 mt(12);
+    for (int n = 0; n < 100000; n++) {
+        uint64_t u = mt() >> (mt() % 64);
+        if (n < 64 * 3)
+            u = (n % 3 == 0 ? 1ull << (n / 3) : n % 3 == 1 ? (1ull << (n / 3)) - 1 : 0);
+        for (uint64_t x : { u, u / 10 * 10, u - 1, u + 1 }) {
+            sprintf(test_buf, "%lu", x);
+            ASSERT_EQ(swar::utoa(x, itoa_ret), strlen(test_buf));
+            ASSERT_STREQ(itoa_ret, test_buf);
+            sprintf(test_buf, "%ld", (int64_t)x);
+            ASSERT_EQ(swar::itoa(x, itoa_ret), strlen(test_buf));
+            ASSERT_STREQ(itoa_ret, test_buf);
+        }
+    }
+    for (uint64_t p = 1; p < 10000000000000000000ull; p *= 10) {
+        for (uint64_t x : { p - 1, p, p + 1 }) {
+            sprintf(test_buf, "%lu", x);
+            ASSERT_EQ(swar::utoa(x, itoa_ret), strlen(test_buf));
+            ASSERT_STREQ(itoa_ret, test_buf);
+        }
+    }
+    EXPECT_EQ(swar::itoa(std::numeric_limits<int64_t>::min(), itoa_ret), 20u);
+    EXPECT_STREQ(itoa_ret, "-9223372036854775808");
+    EXPECT_EQ(swar::utoa(18446744073709551615ull, itoa_ret), 20u);
+    EXPECT_STREQ(itoa_ret, "18446744073709551615");
+
     EXPECT_STREQ(swar::utoap< 1>(0, itoa_ret), "0");
     EXPECT_STREQ(swar::utoap< 2>(0, itoa_ret), "00");
     EXPECT_STREQ(swar::utoap< 3>(0, itoa_ret), "000");
@@ -271,6 +1374,23 @@ TEST(r8, itoa) {
     EXPECT_STREQ(swar::utoap<19>(123456789012345, itoa_ret), "0000123456789012345");
     EXPECT_STREQ(swar::utoap<20>(123456789012345, itoa_ret), "00000123456789012345");
 
+    // Vector path, 9 to 20 digits
+    for (int i = 0; i < 100000; i++) {
+        uint64_t x = mt() % 10000000000000000ull;
+        sprintf(test_buf, "%09lu", x % 1000000000);
+        ASSERT_STREQ(swar::utoap<9>(x % 1000000000, itoa_ret), test_buf);
+        sprintf(test_buf, "%016lu", x);
+        ASSERT_STREQ(swar::utoap<16>(x, itoa_ret), test_buf);
+        x = mt() % 10000000000000000000ull;
+        sprintf(test_buf, "%019lu", x);
+        ASSERT_STREQ(swar::utoap<19>(x, itoa_ret), test_buf);
+        x = mt();
+        sprintf(test_buf, "%020lu", x);
+        ASSERT_STREQ(swar::utoap<20>(x, itoa_ret), test_buf);
+    }
+    EXPECT_STREQ(swar::utoap<16>(9999999999999999ull, itoa_ret), "9999999999999999");
+    EXPECT_STREQ(swar::utoap<20>(18446744073709551615ull, itoa_ret), "18446744073709551615");
+
     swar::itoa8(0,        itoa_ret); EXPECT_STREQ(itoa_ret, "0");
     swar::itoa8(1,        itoa_ret); EXPECT_STREQ(itoa_ret, "1");
     swar::itoa8(12,       itoa_ret); EXPECT_STREQ(itoa_ret, "12");
@@ -280,6 +1400,666 @@ TEST(r8, itoa) {
     swar::itoa8(123456,   itoa_ret); EXPECT_STREQ(itoa_ret, "123456");
     swar::itoa8(1234567,  itoa_ret); EXPECT_STREQ(itoa_ret, "1234567");
     swar::itoa8(12345678, itoa_ret); EXPECT_STREQ(itoa_ret, "12345678");
+    swar::itoa8(-12345678, itoa_ret); EXPECT_STREQ(itoa_ret, "-12345678");
+    swar::itoa8(-1,       itoa_ret); EXPECT_STREQ(itoa_ret, "-1");
+    for (int i = -99999999; i <= 99999999; i += 7777) {
+        sprintf(test_buf, "%d", i);
+        EXPECT_EQ(swar::itoa8(i, itoa_ret), strlen(test_buf));
+        EXPECT_STREQ(itoa_ret, test_buf);
+    }
+}
+
+// hexdump -C, with snprintf
+static std::string naive_hexdump(const uint8_t* p, size_t len) {
+    std::string ret;
+    char tmp[16];
+    for (size_t i = 0; i < len; i += 16) {
+        snprintf(tmp, sizeof(tmp), "%08zx  ", i);
+        ret += tmp;
+        for (size_t j = 0; j < 16; j++) {
+            if (i + j < len)
+                snprintf(tmp, sizeof(tmp), "%02x ", p[i + j]);
+            else
+                snprintf(tmp, sizeof(tmp), "   ");
+            ret += tmp;
+            if (j == 7)
+                ret += ' ';
+        }
+        ret += " |";
+        for (size_t j = i; j < len && j < i + 16; j++)
+            ret += p[j] >= 0x20 && p[j] < 0x7f ? (char)p[j] : '.';
+        ret += "|\n";
+    }
+    return ret;
+}
+
+TEST(r8, utoh) {
+    char buf[32];
+    char expected[32];
+
+    EXPECT_STREQ(swar::utoh8p(0, buf), "00000000");
+    EXPECT_STREQ(swar::utoh8p(0x1234abcd, buf), "1234abcd");
+    EXPECT_STREQ(swar::utoh8p<true>(0x1234abcd, buf), "1234ABCD");
+    EXPECT_STREQ(swar::utohp(0x0123456789abcdefull, buf), "0123456789abcdef");
+    EXPECT_STREQ(swar::utohp<true>(~0ull, buf), "FFFFFFFFFFFFFFFF");
+    EXPECT_EQ(swar::utoh8(0, buf), 1u);
+    EXPECT_STREQ(buf, "0");
+    EXPECT_EQ(swar::utoh(0, buf), 1u);
+    EXPECT_STREQ(buf, "0");
+    EXPECT_EQ(swar::utoh<true>(0xfa, buf), 2u);
+    EXPECT_STREQ(buf, "FA");
+
+    std::mt19937_64 mt(13);
+    for (int i = 0; i < 100000; i++) {
+        uint64_t x = mt() >> (mt() % 64);
+        uint32_t y = x;
+
+        snprintf(expected, sizeof(expected), "%x", y);
+        ASSERT_EQ(swar::utoh8(y, buf), strlen(expected));
+        ASSERT_STREQ(buf, expected);
+        snprintf(expected, sizeof(expected), "%X", y);
+        ASSERT_EQ(swar::utoh8<true>(y, buf), strlen(expected));
+        ASSERT_STREQ(buf, expected);
+        snprintf(expected, sizeof(expected), "%08x", y);
+        ASSERT_STREQ(swar::utoh8p(y, buf), expected);
+
+        snprintf(expected, sizeof(expected), "%lx", x);
+        ASSERT_EQ(swar::utoh(x, buf), strlen(expected));
+        ASSERT_STREQ(buf, expected);
+        snprintf(expected, sizeof(expected), "%lX", x);
+        ASSERT_EQ(swar::utoh<true>(x, buf), strlen(expected));
+        ASSERT_STREQ(buf, expected);
+        snprintf(expected, sizeof(expected), "%016lX", x);
+        ASSERT_STREQ(swar::utohp<true>(x, buf), expected);
+    }
+
+    // Every length of up to 3 lines, and all byte values
+    std::vector<uint8_t> data(256);
+    for (int i = 0; i < 256; i++)
+        data[i] = i;
+    std::string out(80 * 17, 'x');
+    for (size_t len = 0; len <= 48; len++) {
+        std::shuffle(data.begin(), data.end(), mt);
+        size_t n = swar::hexdump(data.data(), len, &out[0]);
+        ASSERT_EQ(std::string(out.data(), n), naive_hexdump(data.data(), len)) << len;
+        ASSERT_EQ(out[n], '\0');
+    }
+    size_t n = swar::hexdump(data.data(), 256, &out[0]);
+    EXPECT_EQ(std::string(out.data(), n), naive_hexdump(data.data(), 256));
+
+    const char* hello = "Hello world\n";
+    swar::hexdump(hello, strlen(hello), &out[0]);
+    EXPECT_STREQ(out.c_str(),
+        "00000000  48 65 6c 6c 6f 20 77 6f  72 6c 64 0a              |Hello world.|\n");
+}
+
+// Reference, with gmtime_r and strftime
+static std::string naive_format_timestamp(int64_t ns, int digits) {
+    time_t t = ns / 1000000000;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    char buf[64];
+    size_t n = strftime(buf, sizeof(buf), "%Y%m%d-%H:%M:%S", &tm);
+    if (digits) {
+        long frac = ns % 1000000000;
+        for (int i = digits; i < 9; i++)
+            frac /= 10;
+        snprintf(buf + n, sizeof(buf) - n, ".%0*ld", digits, frac);
+    }
+    return buf;
+}
+
+template<int Digits>
+static void check_timestamp(int64_t ns) {
+    char buf[32];
+    std::string ref = naive_format_timestamp(ns, Digits);
+    ASSERT_EQ(swar::format_timestamp<Digits>(ns, buf), ref.size());
+    ASSERT_EQ(buf, ref);
+
+    // Back, truncated to Digits
+    int64_t div = 1000000000;
+    for (int i = 0; i < Digits; i++)
+        div /= 10;
+    std::string b = padded(ref.c_str());
+    ASSERT_EQ(swar::parse_timestamp(b.data(), ref.size()), ns / div * div) << ref;
+}
+
+// Format at compile time, into an array
+template <typename F>
+constexpr std::array<char, 48> format_constexpr(F f) {
+    std::array<char, 48> buf{};
+    f(buf.data());
+    return buf;
+}
+
+constexpr bool eq_constexpr(const char* a, const char* b) {
+    for (; *a && *a == *b; a++, b++) {}
+    return *a == *b;
+}
+
+TEST(r8, constexpr) {
+    // Parse, only len chars of a literal
+    static_assert(swar::atou4("123", 3) == 123);
+    static_assert(swar::atou8("12345678", 8) == 12345678);
+    static_assert(swar::atou8("42", 2) == 42);
+    static_assert(swar::atou8("", 0) == 0);
+    static_assert(swar::atou("18446744073709551615", 20) == 18446744073709551615ull);
+    static_assert(swar::atou("123456789", 9) == 123456789);
+    static_assert(swar::atoi("-9223372036854775807", 20) == -9223372036854775807ll);
+    static_assert(swar::atoi("+35", 3) == 35);
+    static_assert(swar::htou8("dEaD", 4) == 0xdead);
+    static_assert(swar::htou("123456789abcdef0", 16) == 0x123456789abcdef0ull);
+    static_assert(swar::cast8("FIX", 3) == 0x584946);
+
+    // Search, in 8 chars
+    static_assert(swar::memchr8("1234=678", '=') == 4);
+    static_assert(swar::memchr8("12345678", '=') == -1u);
+    static_assert(swar::pmemchr8k("35=D\x01" "49=", '\x01') == 4);
+    static_assert(swar::memrchr8("1=34=678", '=') == 4);
+    static_assert(swar::strlen8("abc\0defg") == 3);
+    static_assert(swar::hasbyte(swar::cast<uint64_t>("8=FIX.4."), '.'));
+
+    // Format
+    static_assert(swar::utoa2p(7) == ('0' | '7' << 8));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoa(0, b); }).data(), "0"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoa(1234567890123ull, b); }).data(), "1234567890123"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoa(18446744073709551615ull, b); }).data(), "18446744073709551615"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::itoa(-9223372036854775807ll - 1, b); }).data(), "-9223372036854775808"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::itoa8(-1234567, b); }).data(), "-1234567"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoap<6>(42, b); }).data(), "000042"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoap<12>(123456789, b); }).data(), "000123456789"));
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoap<20>(42, b); }).data(), "00000000000000000042"));
+    static_assert(swar::atou128("340282366920938463463374607431768211455", 39) == ~(unsigned __int128)0);
+    static_assert(eq_constexpr(format_constexpr([](char* b) { swar::utoa128(~(unsigned __int128)0, b); }).data(),
+                               "340282366920938463463374607431768211455"));
+
+    // A header prefix, folded into the binary, matches the runtime one
+    constexpr auto hdr = format_constexpr([](char* b) {
+        b[0] = '9';
+        b[1] = '=';
+        b += 2 + swar::utoa(178, b + 2);
+        *b = '\x01';
+    });
+    char rt[32] = {};
+    rt[0] = '9';
+    rt[1] = '=';
+    rt[2 + swar::utoa(178, rt + 2)] = '\x01';
+    EXPECT_STREQ(hdr.data(), rt);
+
+    // Same as at runtime, for a range of values
+    std::mt19937_64 mt(22);
+    for (int i = 0; i < 1000; i++) {
+        uint64_t x = mt() >> (mt() % 64);
+        char a[32] = {}, b[32] = {};
+        swar::utoa(x, a);
+        snprintf(b, sizeof(b), "%llu", (unsigned long long)x);
+        ASSERT_STREQ(a, b);
+        ASSERT_EQ(swar::atou(a, ::strlen(a)), x);
+    }
 }
 
+TEST(r8, timestamp) {
+    auto parse = [](const char* s) {
+        return swar::parse_timestamp(padded(s).data(), strlen(s));
+    };
+    EXPECT_EQ(parse("19700101-00:00:00"), 0);
+    EXPECT_EQ(parse("19700101-00:00:01.5"), 1500000000);
+    EXPECT_EQ(parse("19700101-00:00:00.000000001"), 1);
+    EXPECT_EQ(parse("20000229-12:34:56.789"), 951827696789000000);
+    EXPECT_EQ(parse("20240315-09:30:00.123456"), 1710495000123456000);
+    EXPECT_EQ(parse("22620411-23:47:16.854775807"), std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(parse("21000301-00:00:00"), 4107542400000000000);
+
+    char buf[32];
+    EXPECT_EQ(swar::format_timestamp(0, buf), 17u);
+    EXPECT_STREQ(buf, "19700101-00:00:00");
+    EXPECT_EQ(swar::format_timestamp<3>(951827696789999999, buf), 21u);
+    EXPECT_STREQ(buf, "20000229-12:34:56.789");
+    EXPECT_EQ(swar::format_timestamp<9>(std::numeric_limits<int64_t>::max(), buf), 27u);
+    EXPECT_STREQ(buf, "22620411-23:47:16.854775807");
+
+    // Midnights up to 2262, and random times
+    for (int64_t day = 0; day < 106751; day += 1 + day % 97)
+        check_timestamp<0>(day * 86400000000000ll);
+    std::mt19937_64 mt(17);
+    for (int i = 0; i < 20000; i++) {
+        int64_t ns = mt() >> 1;
+        check_timestamp<0>(ns);
+        check_timestamp<3>(ns);
+        check_timestamp<6>(ns);
+        check_timestamp<9>(ns);
+        check_timestamp<1>(ns);
+        check_timestamp<8>(ns);
+    }
+}
+
+TEST(r8, tolower) {
+    // All bytes, in each position of the word
+    for (int c = 0; c < 256; c++) {
+        for (int i = 0; i < 8; i++) {
+            char s[8] = { 'x', 'Y', '@', '[', '`', '{', (char)0xc1, (char)0xe1 };
+            s[i] = c;
+            char lo[8], up[8];
+            swar::tolower8(s, lo);
+            swar::toupper8(s, up);
+            for (int j = 0; j < 8; j++) {
+                uint8_t b = s[j];
+                ASSERT_EQ((uint8_t)lo[j], b >= 'A' && b <= 'Z' ? b + 32 : b) << c << " " << i;
+                ASSERT_EQ((uint8_t)up[j], b >= 'a' && b <= 'z' ? b - 32 : b) << c << " " << i;
+            }
+        }
+    }
+
+    // Every length, in place and to another buffer that must not be
+    // written past len
+    std::mt19937 mt(18);
+    for (uint32_t len = 0; len < 40; len++) {
+        std::string s;
+        for (uint32_t i = 0; i < len; i++)
+            s += "aZ09_ -Q"[mt() % 8];
+        std::string lo = s, up = s;
+        for (char& c : lo)
+            c = ::tolower(c);
+        for (char& c : up)
+            c = ::toupper(c);
+
+        std::string src = padded(s.c_str());
+        std::string dst(len + 8, '#');
+        swar::tolower(src.data(), len, &dst[0]);
+        ASSERT_EQ(dst, lo + "########");
+        swar::toupper(src.data(), len, &dst[0]);
+        ASSERT_EQ(dst, up + "########");
+        swar::tolower(&src[0], len, &src[0]);
+        ASSERT_EQ(src.substr(0, len), lo);
+
+        // Equal ignoring case, and not equal if any char differs
+        std::string a = padded(lo.c_str());
+        std::string b = padded(up.c_str());
+        ASSERT_TRUE(swar::eq_ci(a.data(), b.data(), len));
+        for (uint32_t i = 0; i < len; i++) {
+            std::string c = b;
+            c[i] ^= 1;
+            ASSERT_FALSE(swar::eq_ci(a.data(), c.data(), len)) << len << " " << i;
+            c[i] = b[i] ^ 0x20; // '@' vs '`', '_' vs DEL
+            if (!isalpha(b[i])) {
+                ASSERT_FALSE(swar::eq_ci(a.data(), c.data(), len)) << len << " " << i;
+            }
+        }
+    }
+    EXPECT_TRUE(swar::eq8_ci(padded("ibm").data(), padded("IBM").data(), 3));
+    EXPECT_TRUE(swar::eq8_ci(padded("ibmX").data(), padded("IBMY").data(), 3));
+    EXPECT_FALSE(swar::eq8_ci(padded("[").data(), padded("{").data(), 1));
+    EXPECT_FALSE(swar::eq8_ci(padded("@").data(), padded("`").data(), 1));
+
+    // Search in either case
+    std::string hay = padded("Content-Length: 42, content-type: x");
+    EXPECT_EQ(swar::memchr_ci(hay.data(), 35, 'c'), 0u);
+    EXPECT_EQ(swar::pmemchr_ci(hay.data(), 35, 'L'), 8u);
+    EXPECT_EQ(swar::memchr_ci(hay.data() + 1, 34, 'C'), 19u);
+    EXPECT_EQ(swar::memchr_ci(hay.data(), 35, ':'), 14u);
+    EXPECT_EQ(swar::pmemchr_ci(hay.data(), 35, 'Z'), -1u);
+}
+
+TEST(r8, cmp16) {
+    auto sign = [](int x) { return (x > 0) - (x < 0); };
+
+    // Random strings of a few chars, so many are prefixes of each other,
+    // including nulls and bytes >= 128
+    std::mt19937 mt(19);
+    for (int k = 0; k < 200000; k++) {
+        std::string a, b;
+        uint32_t alen = mt() % 17, blen = mt() % 17;
+        for (uint32_t i = 0; i < alen; i++)
+            a += "AB\0\xff"[mt() % 4];
+        for (uint32_t i = 0; i < blen; i++)
+            b += "AB\0\xff"[mt() % 4];
+        // Garbage after the strings must not count. A word of it, on the
+        // heap, so ASan catches a longer read
+        std::string ga = a + std::string(8, '\x7f');
+        std::string gb = b + std::string(8, '\x80');
+        std::vector<char> pa(ga.begin(), ga.end());
+        std::vector<char> pb(gb.begin(), gb.end());
+
+        int expected = sign(a.compare(b));
+        ASSERT_EQ(sign(swar::cmp16(pa.data(), alen, pb.data(), blen)), expected) << k;
+        if (alen <= 8 && blen <= 8) {
+            ASSERT_EQ(sign(swar::cmp8(pa.data(), alen, pb.data(), blen)), expected) << k;
+        }
+        uint32_t len = std::min(alen, blen);
+        bool eq = a.compare(0, len, b, 0, len) == 0;
+        ASSERT_EQ(swar::eq16(pa.data(), pb.data(), len), eq) << k;
+        if (len <= 8) {
+            ASSERT_EQ(swar::eq8(pa.data(), pb.data(), len), eq) << k;
+        }
+    }
+
+    EXPECT_LT(swar::cmp8(padded("IBM").data(), 3, padded("MSFT").data(), 4), 0);
+    EXPECT_GT(swar::cmp8(padded("IBMX").data(), 4, padded("IBM").data(), 3), 0);
+    EXPECT_EQ(swar::cmp8(padded("IBM").data(), 3, padded("IBMX").data(), 3), 0);
+    EXPECT_LT(swar::cmp16(padded("ORD-0000000009").data(), 14, padded("ORD-0000000010").data(), 14), 0);
+    EXPECT_TRUE(swar::eq16(padded("XNYS.ARCA.EDGX").data(), padded("XNYS.ARCA.EDGX").data(), 14));
+    EXPECT_FALSE(swar::eq16(padded("XNYS.ARCA.EDGX").data(), padded("XNYS.ARCA.EDGA").data(), 14));
+}
+
+TEST(fix, field_iterator) {
+    // Padded for the SWAR over-read
+    char msg[128] = "8=FIX.4.4\x01" "9=65\x01" "35=D\x01" "49=SENDER\x01"
+                    "11=ORD-123456789012345678\x01" "12345=x\x01" "58=\x01" "10=123\x01";
+    uint32_t len = ::strlen(msg);
+
+    swar::fix::field_iterator it(msg, len);
+    swar::fix::field f;
+
+    const uint32_t tags[] = { 8, 9, 35, 49, 11, 12345, 58, 10 };
+    const char* values[] = { "FIX.4.4", "65", "D", "SENDER",
+                             "ORD-123456789012345678", "x", "", "123" };
+    for (int i = 0; i < 8; i++) {
+        ASSERT_TRUE(it.next(f));
+        EXPECT_EQ(f.tag, tags[i]);
+        EXPECT_EQ(std::string(f.value, f.len), values[i]);
+    }
+    EXPECT_FALSE(it.next(f));
+    EXPECT_EQ(it.pos(), msg + len);
+
+    // Incomplete last field is ignored
+    swar::fix::field_iterator it2(msg, len - 2);
+    int n = 0;
+    while (it2.next(f))
+        n++;
+    EXPECT_EQ(n, 7);
+
+    // Malformed fields stop the iteration
+    char bad1[32] = "35=D\x01" "abc\x01";
+    swar::fix::field_iterator it3(bad1, ::strlen(bad1));
+    EXPECT_TRUE(it3.next(f));
+    EXPECT_FALSE(it3.next(f));
+
+    char bad2[32] = "=D\x01";
+    swar::fix::field_iterator it4(bad2, ::strlen(bad2));
+    EXPECT_FALSE(it4.next(f));
+
+    char bad3[32] = "123456789=D\x01";
+    swar::fix::field_iterator it5(bad3, ::strlen(bad3));
+    EXPECT_FALSE(it5.next(f));
+
+    swar::fix::field_iterator it6(msg, 0);
+    EXPECT_FALSE(it6.next(f));
+}
 
+// index_iterator must see the same fields as field_iterator
+TEST(fix, index_iterator) {
+    std::mt19937 mt(3);
+    for (int n = 0; n < 2000; n++) {
+        // Random fields, some with '=' in the value, long values, and
+        // malformed ones
+        std::string msg;
+        int nfields = mt() % 30;
+        for (int i = 0; i < nfields; i++) {
+            if (mt() % 50)
+                msg += std::to_string(mt() % (mt() % 2 ? 100 : 100000));
+            if (mt() % 50)
+                msg += '=';
+            int vlen = mt() % 8 ? mt() % 12 : mt() % 150;
+            for (int j = 0; j < vlen; j++)
+                msg += mt() % 10 ? 'a' + j % 26 : '=';
+            msg += '\x01';
+        }
+        if (mt() % 4 == 0)
+            msg += "58=trail";
+
+        std::vector<char> buf(msg.begin(), msg.end());
+        buf.resize(msg.size() + 8);
+
+        // Padding of fields, that are past the end
+        swar::padded_buffer pb(msg.size());
+        pb.assign(msg.data(), msg.size());
+        for (uint32_t i = 0; i < swar::padding; i++)
+            pb.data()[msg.size() + i] = "1=\x01"[i % 3];
+
+        swar::fix::field_iterator it1(buf.data(), msg.size());
+        swar::fix::index_iterator it2(buf.data(), msg.size());
+        swar::fix::index_iterator it3(pb);
+        swar::fix::field f1, f2, f3;
+        for (;;) {
+            bool r1 = it1.next(f1);
+            bool r2 = it2.next(f2);
+            bool r3 = it3.next(f3);
+            ASSERT_EQ(r1, r2) << msg;
+            ASSERT_EQ(r1, r3) << msg;
+            if (!r1)
+                break;
+            ASSERT_EQ(f1.tag, f2.tag);
+            ASSERT_EQ(f1.value, f2.value);
+            ASSERT_EQ(f1.len, f2.len);
+            ASSERT_EQ(f1.tag, f3.tag);
+            ASSERT_EQ(f1.value - buf.data(), f3.value - pb.data());
+            ASSERT_EQ(f1.len, f3.len);
+        }
+    }
+}
+
+TEST(map, short_string_map) {
+    // Keys of a few chars, so many are prefixes of each other, including
+    // nulls. Values that own memory, so leaks show
+    std::mt19937 mt(20);
+    auto key = [&mt]() {
+        std::string k;
+        uint32_t len = mt() % 17;
+        for (uint32_t i = 0; i < len; i++)
+            k += "ABC\0"[mt() % 4];
+        return k;
+    };
+
+    swar::short_string_map<std::string> m;
+    std::map<std::string, std::string> ref;
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 20000; i++) {
+            std::string k = key();
+            std::string pk = k + std::string(16, '#');
+            std::string v = "v" + k;
+            switch (mt() % 3) {
+            case 0: {
+                auto r = m.insert(pk.data(), k.size(), v);
+                bool inserted = ref.emplace(k, v).second;
+                ASSERT_EQ(r.second, inserted) << i;
+                ASSERT_EQ(*r.first, ref[k]) << i;
+                break;
+            }
+            case 1:
+                ASSERT_EQ(m.erase(pk.data(), k.size()), ref.erase(k) == 1) << i;
+                break;
+            default: {
+                std::string* p = m.find(pk.data(), k.size());
+                auto it = ref.find(k);
+                ASSERT_EQ(p != nullptr, it != ref.end()) << i;
+                if (p) {
+                    ASSERT_EQ(*p, it->second) << i;
+                }
+            }
+            }
+            ASSERT_EQ(m.size(), ref.size());
+        }
+        for (auto& kv : ref) {
+            std::string pk = kv.first + std::string(16, '#');
+            std::string* p = m.find(pk.data(), kv.first.size());
+            ASSERT_TRUE(p != nullptr);
+            ASSERT_EQ(*p, kv.second);
+        }
+        if (round == 1) {
+            m.clear();
+            ref.clear();
+            EXPECT_TRUE(m.empty());
+        }
+    }
+
+    // Longer keys are never there
+    std::string longkey = padded("ABCDEFGHIJKLMNOPQ");
+    EXPECT_FALSE(m.insert(longkey.data(), 17, "x").first);
+    EXPECT_FALSE(m.find(longkey.data(), 17));
+    EXPECT_FALSE(m.erase(longkey.data(), 17));
+
+    // Symbols
+    swar::short_string_map<uint32_t> ids(4);
+    const char* syms[] = { "IBM", "MSFT", "BRK.A", "ESZ4 C4500", "ORD-0123456789AB" };
+    for (uint32_t i = 0; i < 5; i++) {
+        std::string s = padded(syms[i]);
+        EXPECT_TRUE(ids.insert(s.data(), ::strlen(syms[i]), i).second);
+    }
+    for (uint32_t i = 0; i < 5; i++) {
+        std::string s = padded(syms[i]);
+        const uint32_t* p = ids.find(s.data(), ::strlen(syms[i]));
+        ASSERT_TRUE(p != nullptr);
+        EXPECT_EQ(*p, i);
+    }
+    EXPECT_FALSE(ids.find(padded("IB").data(), 2));
+    EXPECT_FALSE(ids.find(padded("ORD-0123456789AB").data(), 15));
+
+    // Keys with only 7 bytes after them
+    for (uint32_t len = 0; len <= 16; len++) {
+        std::vector<char> k(std::max(len + 7, 8u), 'K');
+        EXPECT_EQ(ids.insert(k.data(), len, 100 + len).second, true) << len;
+        const uint32_t* p = ids.find(k.data(), len);
+        ASSERT_TRUE(p != nullptr) << len;
+        EXPECT_EQ(*p, 100 + len);
+    }
+}
+
+TEST(map, keyword_map) {
+    // FIX MsgType(35), and all strings of 1 to 3 chars from their alphabet,
+    // against a strcmp chain
+    enum class msg_type { none, heartbeat, test_request, resend, reject, seq_reset,
+        logout, logon, new_order, cancel, replace, exec_report, cancel_reject,
+        md_request, md_snapshot, md_incremental, trade_report, trade_report_ack,
+        quote_request, quote };
+    static constexpr swar::keyword_map<msg_type, 19>::entry entries[] = {
+        { "0", msg_type::heartbeat }, { "1", msg_type::test_request },
+        { "2", msg_type::resend }, { "3", msg_type::reject },
+        { "4", msg_type::seq_reset }, { "5", msg_type::logout },
+        { "A", msg_type::logon }, { "D", msg_type::new_order },
+        { "F", msg_type::cancel }, { "G", msg_type::replace },
+        { "8", msg_type::exec_report }, { "9", msg_type::cancel_reject },
+        { "V", msg_type::md_request }, { "W", msg_type::md_snapshot },
+        { "X", msg_type::md_incremental }, { "AE", msg_type::trade_report },
+        { "AR", msg_type::trade_report_ack }, { "R", msg_type::quote_request },
+        { "S", msg_type::quote } };
+    static constexpr swar::keyword_map<msg_type, 19> msg_types(entries, msg_type::none);
+
+    const char alphabet[] = "0123589ADEFGRSVWX\x01";
+    uint32_t n = ::strlen(alphabet);
+    for (uint32_t a = 0; a < n; a++) {
+        for (uint32_t b = 0; b <= n; b++) {
+            for (uint32_t c = 0; c <= n; c++) {
+                char s[16] = {};
+                s[0] = alphabet[a];
+                s[1] = b < n ? alphabet[b] : 0;
+                s[2] = c < n ? alphabet[c] : 0;
+                uint32_t len = ::strlen(s);
+                msg_type expected = msg_type::none;
+                for (auto& e : entries) {
+                    if (len == ::strlen(e.word) && ::strncmp(s, e.word, len) == 0)
+                        expected = e.value;
+                }
+                ASSERT_EQ(msg_types.find(s, len), expected) << s;
+            }
+        }
+    }
+    // Keyword followed by garbage
+    EXPECT_EQ(msg_types.find(padded("AEX").data(), 2), msg_type::trade_report);
+    EXPECT_EQ(msg_types.find(padded("D\x01").data(), 1), msg_type::new_order);
+    EXPECT_EQ(msg_types.find(padded("").data(), 0), msg_type::none);
+
+    // 8 char keywords, and longer input with the same first 8 chars
+    constexpr swar::keyword_map<int, 6> venues({
+        { "XNYS", 1 }, { "XNAS", 2 }, { "ARCX", 3 }, { "BATS", 4 },
+        { "IEXG", 5 }, { "EDGXEDGA", 6 } }, 0);
+    EXPECT_EQ(venues.find(padded("XNAS").data(), 4), 2);
+    EXPECT_EQ(venues.find(padded("XNASX").data(), 5), 0);
+    EXPECT_EQ(venues.find(padded("XNA").data(), 3), 0);
+    EXPECT_EQ(venues.find(padded("EDGXEDGA").data(), 8), 6);
+    EXPECT_EQ(venues.find(padded("EDGXEDGAB").data(), 9), 0);
+    EXPECT_EQ(venues.find(padded("xnys").data(), 4), 0);
+
+    // One keyword
+    constexpr swar::keyword_map<int, 1> one({ { "Y", 7 } }, -1);
+    EXPECT_EQ(one.find(padded("Y").data(), 1), 7);
+    EXPECT_EQ(one.find(padded("N").data(), 1), -1);
+}
+
+TEST(record, parse) {
+    typedef swar::record<
+        swar::field<0, 8, swar::u32>,
+        swar::field<8, 12, swar::fixed<4>>,
+        swar::field<20, 6, swar::alpha>,
+        swar::field<26, 3, swar::u32>,
+        swar::field<29, 10, swar::u64>,
+        swar::field<39, 16, swar::u64>,
+        swar::field<55, 9, swar::i64>,
+        swar::field<64, 12, swar::hex>
+    > rec;
+    static_assert(rec::count == 8);
+    static_assert(rec::size == 76);
+
+    // Numbers padded with zeros, or spaces, on the left. Signed ones with
+    // zeros, after the sign
+    std::mt19937_64 mt(23);
+    const size_t n = 1001;
+    const size_t stride = rec::size + 1; // and '\n'
+    std::string buf;
+    std::vector<rec::values> expected;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t a = mt() % 100000000;
+        int64_t price = (int64_t)(mt() % 10000000000ull) - 5000000000ll;
+        char sym[8] = {};
+        for (int j = 0; j < 6; j++)
+            sym[j] = j < 1 + (int)(mt() % 6) ? 'A' + mt() % 26 : ' ';
+        uint32_t b = mt() % 1000;
+        uint64_t c = mt() % 10000000000ull;
+        uint64_t d = mt() % 10000000000000000ull;
+        int64_t e = (int64_t)(mt() % 200000000) - 100000000;
+        uint64_t f = mt() >> 16;
+
+        char line[128];
+        int len = snprintf(line, sizeof(line), i % 2 ? "%08u%012.4f%s%03u%10llu%016llu%+09lld%012llx\n"
+                                                     : "%8u%012.4f%s%3u%10llu%16llu%+09lld%012llX\n",
+                           a, price / 10000.0, sym, b, (unsigned long long)c, (unsigned long long)d, (long long)e,
+                           (unsigned long long)f);
+        ASSERT_EQ(len, (int)stride) << line;
+        buf += line;
+        expected.emplace_back(a, price, swar::cast8(sym, 6), b, c, d, e, f);
+    }
+    buf.append(16, '\0');
+
+    for (size_t i = 0; i < n; i++) {
+        const char* r = buf.data() + i * stride;
+        ASSERT_EQ(rec::parse(r), expected[i]) << i;
+        ASSERT_EQ(rec::get<1>(r), std::get<1>(expected[i])) << i;
+    }
+
+    // To columns, and a skipped one
+    std::vector<uint32_t> a(n), b(n);
+    std::vector<uint64_t> c(n);
+    std::vector<int64_t> price(n), e(n);
+    std::vector<uint64_t> sym(n), d(n), f(n);
+    rec::parse_batch(buf.data(), stride, n, rec::columns(a.data(), price.data(), sym.data(),
+                     b.data(), nullptr, d.data(), e.data(), f.data()));
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(a[i], std::get<0>(expected[i])) << i;
+        ASSERT_EQ(price[i], std::get<1>(expected[i])) << i;
+        ASSERT_EQ(sym[i], std::get<2>(expected[i])) << i;
+        ASSERT_EQ(b[i], std::get<3>(expected[i])) << i;
+        ASSERT_EQ(c[i], 0u) << i;
+        ASSERT_EQ(d[i], std::get<5>(expected[i])) << i;
+        ASSERT_EQ(e[i], std::get<6>(expected[i])) << i;
+        ASSERT_EQ(f[i], std::get<7>(expected[i])) << i;
+    }
+
+    // At compile time, with only constexpr field types
+    typedef swar::record<
+        swar::field<0, 4, swar::alpha>,
+        swar::field<4, 3, swar::u32>,
+        swar::field<7, 8, swar::u64>
+    > quote;
+    static_assert(quote::get<0>("IBM 042 0012345") == swar::cast8("IBM ", 4));
+    static_assert(quote::get<1>("IBM 042 0012345") == 42);
+    static_assert(quote::get<2>("IBM 042 0012345") == 12345);
+}